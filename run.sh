@@ -1,8 +1,15 @@
-# Compile Shaders
-./scripts/compileShaders.sh
-
-# Compile Project
+# Compile Project - Shaders Are Compiled by The Build When Their Sources Change
 cd build
 make
+cd ..
+
+# Cook Textures
+./scripts/cookTextures.sh
+
+# Cook Meshes
+./scripts/cookMeshes.sh
+
+# Run Project
+cd build
 ./learningSokol
 cd ..
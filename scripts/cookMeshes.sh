@@ -0,0 +1,11 @@
+# Variables
+MESH_COOKER_BIN="$(pwd)/build/meshCooker"
+MESH_SRC_DIR="$(pwd)/assets/meshes"
+MESH_BUILD_DIR="$(pwd)/assets/meshes/cooked"
+MESH_COOKER_FLAGS="${MESH_COOKER_FLAGS:-}" # Set to --quantize For 16-Bit Positions/TexCoords and 8-Bit Normals
+
+# Cook Meshes - Keep The Source Extension Like Cooked Textures Do
+mkdir -p ${MESH_BUILD_DIR}
+for MESH in ${MESH_SRC_DIR}/*.obj; do
+    ${MESH_COOKER_BIN} ${MESH_COOKER_FLAGS} ${MESH} ${MESH_BUILD_DIR}/$(basename ${MESH}).sglmesh
+done
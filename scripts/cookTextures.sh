@@ -0,0 +1,11 @@
+# Variables
+TEXTURE_COOKER_BIN="$(pwd)/build/textureCooker"
+TEXTURE_SRC_DIR="$(pwd)/assets/textures"
+TEXTURE_BUILD_DIR="$(pwd)/assets/textures/cooked"
+TEXTURE_COOKER_FLAGS="${TEXTURE_COOKER_FLAGS:-}" # Set to --compress For BC1/BC3 Texture Blobs
+
+# Cook Textures - Keep The Source Extension So wall.jpg and wall.png Do Not Collide
+mkdir -p ${TEXTURE_BUILD_DIR}
+for TEXTURE in ${TEXTURE_SRC_DIR}/*.jpg ${TEXTURE_SRC_DIR}/*.png; do
+    ${TEXTURE_COOKER_BIN} ${TEXTURE_COOKER_FLAGS} ${TEXTURE} ${TEXTURE_BUILD_DIR}/$(basename ${TEXTURE}).sgltex
+done
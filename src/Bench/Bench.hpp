@@ -0,0 +1,160 @@
+#pragma once
+
+// Custom Engine Header
+#include"../Engine/Engine.hpp"
+
+// Shaders - Generated by sokol-shdc
+#include"../shaders/build/testShader.h"
+#include"../shaders/build/surfaceShaderPermutations.h"
+
+// Standard Headers
+#include<chrono>
+#include<random>
+#include<array>
+#include<utility>
+
+namespace bench {
+    // Clock Used to Time Benchmarks
+    using Clock = std::chrono::steady_clock;
+
+    // Milliseconds Elapsed Since a Clock Time Point
+    inline double msSince(const Clock::time_point &start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // Frames Rendered Per Scene - Set With --frames
+    inline int numSceneFrames {300};
+
+    // Directory Scenes Write Chrome Traces To - Set With --trace, Empty to Skip
+    inline std::filesystem::path traceDirectory;
+
+    // Shader Desc For The Dummy Backend - It Ignores Shader Sources, Only The Reflection Info Is Used
+    inline const sg_shader_desc* findShaderDesc(const sg_shader_desc* (*shaderDescFunc)(sg_backend)) {
+        for(const sg_backend backend : {SG_BACKEND_GLCORE33, SG_BACKEND_METAL_MACOS, SG_BACKEND_D3D11}) {
+            if(const sg_shader_desc* shaderDesc {shaderDescFunc(backend)}) return shaderDesc;
+        }
+        return nullptr;
+    }
+    inline const sg_shader_desc* testShaderDesc(void) {return findShaderDesc(testShader_shader_desc);}
+    inline const sg_shader_desc* surfaceShaderDesc(const uint32_t &permutationMask = 0) {return findShaderDesc(surfaceShader_permutations[permutationMask]);}
+
+    // Surface Shader Permutation Table For sgl::ShaderRegistry on The Dummy Backend - Each Entry Looks Its Permutation Up With findShaderDesc
+    template<uint32_t Mask> const sg_shader_desc* surfaceShaderPermutationDesc(sg_backend) {return findShaderDesc(surfaceShader_permutations[Mask]);}
+    template<uint32_t... Masks> constexpr std::array<sgl::ShaderRegistry::ShaderDescFunc, sizeof...(Masks)> makeSurfaceShaderPermutations(std::integer_sequence<uint32_t, Masks...>) {
+        return {surfaceShaderPermutationDesc<Masks>...};
+    }
+    inline const std::array surfaceShaderPermutations {makeSurfaceShaderPermutations(std::make_integer_sequence<uint32_t, surfaceShader_permutation_count>())};
+
+    // Triangle Shared by Bench Scenes - Position (XYZ) and Texture Coordinates (UV), Indexed With 16-Bit Indices
+    inline const float triangleVertices[] {
+        -0.4f, -0.5f, 0.0f, 0.0f, 0.0f,
+        0.4f, -0.5f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.5f, 0.0f, 0.5f, 1.0f,
+    };
+    inline const uint16_t triangleIndices[] {0, 1, 2};
+
+    // Triangle Vertex and Index Buffers
+    inline sgl::BufferHandle makeTriangleVertexBuffer(void) {
+        sg_buffer_desc vboDesc {};
+        vboDesc.data = SG_RANGE(triangleVertices);
+        return sgl::BufferHandle(sg_make_buffer(vboDesc));
+    }
+    inline sgl::BufferHandle makeTriangleIndexBuffer(void) {
+        sg_buffer_desc iboDesc {};
+        iboDesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+        iboDesc.data = SG_RANGE(triangleIndices);
+        return sgl::BufferHandle(sg_make_buffer(iboDesc));
+    }
+
+    // White 1x1 RGBA8 Image For Benches That Only Need Something Bound
+    inline sg_image_desc whiteImageDesc(void) {
+        static const uint32_t pixel {0xffffffff};
+        sg_image_desc imgDesc {};
+        imgDesc.width = 1;
+        imgDesc.height = 1;
+        imgDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+        imgDesc.data.subimage[0][0] = SG_RANGE(pixel);
+        return imgDesc;
+    }
+
+    // Sampler With Default Settings
+    inline sgl::SamplerHandle makeDefaultSampler(void) {
+        sg_sampler_desc samplerDesc {};
+        return sgl::SamplerHandle(sg_make_sampler(samplerDesc));
+    }
+
+    // Bumpy UV Sphere - Duplicated Seam Column and Pole Rows, Like an Exported Mesh
+    inline sgl::MeshData makeBumpySphere(const int &rings, const int &segments) {
+        sgl::MeshData mesh;
+        for(int ring {0}; ring <= rings; ring++) {
+            for(int segment {0}; segment <= segments; segment++) {
+                const float theta {glm::pi<float>() * ring / rings}, phi {glm::two_pi<float>() * (segment % segments) / segments};
+                const glm::vec3 normal {glm::sin(theta) * glm::cos(phi), glm::cos(theta), glm::sin(theta) * glm::sin(phi)};
+                const float bump {0.05f * glm::sin(theta * 9.0f) * glm::sin(phi * 7.0f)};
+                mesh.positions.push_back(normal * (1.0f + bump));
+                mesh.normals.push_back(normal);
+                mesh.texCoords.push_back({static_cast<float>(segment) / segments, static_cast<float>(ring) / rings});
+            }
+        }
+        for(int ring {0}; ring < rings; ring++) {
+            for(int segment {0}; segment < segments; segment++) {
+                const uint32_t i0 {static_cast<uint32_t>(ring * (segments + 1) + segment)}, i1 {i0 + segments + 1};
+                mesh.indices.insert(mesh.indices.end(), {i0, i0 + 1, i1, i1, i0 + 1, i1 + 1});
+            }
+        }
+        return mesh;
+    }
+
+    // Benchmarks - Each Prints a Single JSON Object to Standard Output
+    // Texture Loading - Serial Decode and Upload vs sgl::TextureLoader Worker Threads
+    void textureLoad(void);
+
+    // Texture Atlas - sg_apply_bindings Calls Per Frame For 10k Sprites With and Without an Atlas
+    void textureAtlas(void);
+
+    // Render Queue - Draws Per Second and Skipped State Changes For 100k Draw Packets, Sorted vs Submission Order
+    void renderQueue(void);
+
+    // Uniforms - Frame, Material and Object Uniform Blocks For 100k Draw Packets, Applied Every Draw vs Deduplicated by sgl::UniformManager
+    void uniforms(void);
+
+    // Materials - Bindings and Pipeline Switches For 1000 Materials x 100 Objects, Immediate Draws in Scene Order vs sgl::Material Through sgl::RenderQueue
+    void materials(void);
+
+    // Job System Scaling - Transform Update For 1M Entities on sgl::JobSystem, 1 to N Threads
+    void jobScaling(void);
+
+    // Transforms - 1M Transform Updates Per Frame, Naive Per-Object glm vs sgl::TransformStore
+    void transforms(void);
+
+    // Scene Graph - Dirty Subtree Updates in a 100k Node Forest, a Few Animated Nodes vs Everything Dirty
+    void sceneGraph(void);
+
+    // Culling - 1M Bounding Spheres and AABBs Against a Turning Camera's Frustum, Scalar vs SIMD vs SIMD on The Job System
+    void culling(void);
+
+    // BVH - Build, Refit and Query Throughput at 100k and 1M Objects, Against Linear Culling and Ray Casts
+    void bvh(void);
+
+    // LOD - Chain Generation and Per-Object Selection While The Camera Moves, Triangles Drawn With and Without LODs
+    void lod(void);
+
+    // Mesh Loading - Parsing an OBJ File vs Mapping Its Cooked Mesh Blob Straight Into GPU Buffers
+    void meshLoad(void);
+
+    // Mesh Optimisation - ACMR and Bytes Per Vertex of an Exporter-Shuffled Mesh Before and After The meshCooker Passes
+    void meshOptimize(void);
+
+    // Shapes - Draws Per Second and Bindings Applied For 10k Objects Drawing 50 Shapes, One Shared sgl::ShapeCache vs a Buffer Pair Per Shape
+    void shapes(void);
+
+    // Scenes - Scripted Workloads Rendered For numSceneFrames, Reporting CPU Frame Time Percentiles and Sokol Frame Stats
+    // Triangles - 10k Individually Transformed Triangles Through sgl::RenderQueue
+    void trianglesScene(void);
+
+    // Instanced - 100x100 Grid of Triangles in One Instanced Draw Through sgl::InstanceBuffer
+    void instancedScene(void);
+
+    // Transient - 10k Sprites Rebuilt Every Frame Into sgl::TransientBuffer, Drawn in Batches
+    void transientScene(void);
+};
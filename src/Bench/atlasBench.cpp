@@ -0,0 +1,186 @@
+#include"Bench.hpp"
+
+// Scene - Sprites Drawn in Random Order, Each Using One of a Set of Small Distinct Images
+static const int numSprites {10000};
+static const int numSpriteImages {256};
+static const int spriteImageSize {32};
+
+// Atlas Page Size and Padding
+static const int atlasPageSize {256};
+static const int atlasPadding {1};
+
+// Frames Rendered Per Measurement
+static const int numFrames {100};
+
+// Quad in Sprite Space - Position (XYZ) and Texture Coordinates (UV), Same Layout as The Test Object
+static const float quadVertices[4 * 5] {
+    -0.5f, -0.5f, 0.0f, 0.0f, 0.0f,
+    0.5f, -0.5f, 0.0f, 1.0f, 0.0f,
+    0.5f, 0.5f, 0.0f, 1.0f, 1.0f,
+    -0.5f, 0.5f, 0.0f, 0.0f, 1.0f,
+};
+static const uint16_t quadIndices[6] {0, 1, 2, 0, 2, 3};
+
+// Render Frames and Return The Average CPU Milliseconds Per Frame and The Last Frame's Stats
+template<typename RenderFunc> static double renderFrames(RenderFunc renderFunc, sg_frame_stats &frameStats) {
+    sg_pass_action passAction {};
+    const bench::Clock::time_point start {bench::Clock::now()};
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        renderFunc();
+        sg_end_pass();
+        sg_commit();
+    }
+    const double frameMs {bench::msSince(start) / numFrames};
+    frameStats = sg_query_frame_stats();
+    return frameMs;
+}
+
+// Texture Atlas - sg_apply_bindings Calls Per Frame For 10k Sprites With and Without an Atlas
+void bench::textureAtlas(void) {
+    // Sprite Images - Solid Colors
+    std::mt19937 rng(1234);
+    std::vector<std::vector<uint8_t>> spriteImages(numSpriteImages);
+    for(std::vector<uint8_t> &spriteImage : spriteImages) {
+        const uint8_t color[4] {static_cast<uint8_t>(rng()), static_cast<uint8_t>(rng()), static_cast<uint8_t>(rng()), 255};
+        for(int i {0}; i < spriteImageSize * spriteImageSize; i++) {
+            spriteImage.insert(spriteImage.end(), color, color + 4);
+        }
+    }
+
+    // Sprites - Image and Position
+    std::vector<int> spriteImageIndices(numSprites);
+    std::vector<glm::vec2> spritePositions(numSprites);
+    std::uniform_real_distribution<float> positionDist(-1.0f, 1.0f);
+    for(int i {0}; i < numSprites; i++) {
+        spriteImageIndices[i] = static_cast<int>(rng() % numSpriteImages);
+        spritePositions[i] = glm::vec2(positionDist(rng), positionDist(rng));
+    }
+
+    // Shared GPU Objects
+    sg_shader shader {sg_make_shader(testShaderDesc())};
+    sg_sampler_desc samplerDesc {};
+    sg_sampler sampler {sg_make_sampler(samplerDesc)};
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.shader = shader;
+    pipelineDesc.layout.attrs[ATTR_vs_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+    pipelineDesc.layout.attrs[ATTR_vs_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+    sg_pipeline pipeline {sg_make_pipeline(pipelineDesc)};
+    sg_image_desc imgDesc {};
+    imgDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    testVSUniforms_t vsUniforms {};
+
+    // Without Atlas - One Image Per Sprite Image, One Quad Drawn Per Sprite, Bindings Applied When The Image Changes
+    std::vector<sg_image> images;
+    for(const std::vector<uint8_t> &spriteImage : spriteImages) {
+        sg_image_desc spriteImgDesc {imgDesc};
+        spriteImgDesc.width = spriteImageSize;
+        spriteImgDesc.height = spriteImageSize;
+        spriteImgDesc.data.subimage[0][0] = {spriteImage.data(), spriteImage.size()};
+        images.push_back(sg_make_image(spriteImgDesc));
+    }
+    sg_buffer_desc quadVBODesc {};
+    quadVBODesc.data = SG_RANGE(quadVertices);
+    sg_buffer_desc quadIBODesc {};
+    quadIBODesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    quadIBODesc.data = SG_RANGE(quadIndices);
+    sg_bindings quadBindings {};
+    quadBindings.vertex_buffers[0] = sg_make_buffer(quadVBODesc);
+    quadBindings.index_buffer = sg_make_buffer(quadIBODesc);
+    quadBindings.fs.samplers[SLOT_testTexSmp] = sampler;
+    sg_frame_stats directStats;
+    const double directMs {renderFrames([&](void) {
+        sg_apply_pipeline(pipeline);
+        sg_image boundImage {SG_INVALID_ID};
+        for(int i {0}; i < numSprites; i++) {
+            const sg_image image {images[static_cast<size_t>(spriteImageIndices[i])]};
+            if(image.id != boundImage.id) {
+                quadBindings.fs.images[SLOT_testTexImg] = image;
+                sg_apply_bindings(quadBindings);
+                boundImage = image;
+            }
+            vsUniforms.pvm = glm::translate(glm::mat4(1.0f), glm::vec3(spritePositions[i], 0.0f));
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_testVSUniforms, SG_RANGE(vsUniforms));
+            sg_draw(0, 6, 1);
+        }
+    }, directStats)};
+
+    // With Atlas - Sprites Baked Into One Vertex Buffer With Atlas Texture Coordinates, One Draw Per Atlas Page
+    const Clock::time_point atlasBuildStart {Clock::now()};
+    sgl::TextureAtlas atlas(atlasPageSize, atlasPadding);
+    for(const std::vector<uint8_t> &spriteImage : spriteImages) {
+        atlas.addPixels(spriteImage.data(), spriteImageSize, spriteImageSize);
+    }
+    atlas.build(imgDesc);
+    const double atlasBuildMs {msSince(atlasBuildStart)};
+
+    // Group Sprites by Atlas Page
+    std::vector<int> spriteOrder(numSprites);
+    for(int i {0}; i < numSprites; i++) spriteOrder[i] = i;
+    std::stable_sort(spriteOrder.begin(), spriteOrder.end(), [&](const int &a, const int &b) {
+        return atlas.getSprite(spriteImageIndices[a]).page < atlas.getSprite(spriteImageIndices[b]).page;
+    });
+
+    // Bake Sprites - Positions in World Space, Texture Coordinates Remapped to Atlas Space
+    std::vector<float> atlasVertices;
+    std::vector<uint16_t> atlasIndices;
+    std::vector<int> pageFirstSprite(static_cast<size_t>(atlas.getPageCount()) + 1, numSprites);
+    for(int i {numSprites - 1}; i >= 0; i--) {
+        pageFirstSprite[static_cast<size_t>(atlas.getSprite(spriteImageIndices[spriteOrder[i]]).page)] = i;
+    }
+    for(int i {atlas.getPageCount() - 1}; i >= 0; i--) {
+        pageFirstSprite[i] = std::min(pageFirstSprite[i], pageFirstSprite[i + 1]);
+    }
+    for(const int &sprite : spriteOrder) {
+        float vertices[4 * 5];
+        std::memcpy(vertices, quadVertices, sizeof(vertices));
+        for(int v {0}; v < 4; v++) {
+            vertices[v * 5 + 0] += spritePositions[sprite].x;
+            vertices[v * 5 + 1] += spritePositions[sprite].y;
+        }
+        atlas.remapTexCoords(spriteImageIndices[sprite], vertices, 4, 5, 3);
+        const uint16_t baseVertex {static_cast<uint16_t>(atlasVertices.size() / 5)};
+        for(const uint16_t &index : quadIndices) atlasIndices.push_back(static_cast<uint16_t>(baseVertex + index));
+        atlasVertices.insert(atlasVertices.end(), vertices, vertices + 4 * 5);
+    }
+    sg_buffer_desc atlasVBODesc {};
+    atlasVBODesc.data = {atlasVertices.data(), atlasVertices.size() * sizeof(float)};
+    sg_buffer_desc atlasIBODesc {};
+    atlasIBODesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    atlasIBODesc.data = {atlasIndices.data(), atlasIndices.size() * sizeof(uint16_t)};
+    sg_bindings atlasBindings {};
+    atlasBindings.vertex_buffers[0] = sg_make_buffer(atlasVBODesc);
+    atlasBindings.index_buffer = sg_make_buffer(atlasIBODesc);
+    atlasBindings.fs.samplers[SLOT_testTexSmp] = sampler;
+    sg_frame_stats atlasStats;
+    const double atlasMs {renderFrames([&](void) {
+        sg_apply_pipeline(pipeline);
+        vsUniforms.pvm = glm::mat4(1.0f);
+        for(int page {0}; page < atlas.getPageCount(); page++) {
+            if(pageFirstSprite[page] == pageFirstSprite[page + 1]) continue;
+            atlasBindings.fs.images[SLOT_testTexImg] = atlas.getPageImage(page);
+            sg_apply_bindings(atlasBindings);
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_testVSUniforms, SG_RANGE(vsUniforms));
+            sg_draw(pageFirstSprite[page] * 6, (pageFirstSprite[page + 1] - pageFirstSprite[page]) * 6, 1);
+        }
+    }, atlasStats)};
+
+    // Destroy GPU Objects
+    for(const sg_image &image : images) sg_destroy_image(image);
+    for(const sg_bindings &bindings : {quadBindings, atlasBindings}) {
+        sg_destroy_buffer(bindings.vertex_buffers[0]);
+        sg_destroy_buffer(bindings.index_buffer);
+    }
+    sg_destroy_pipeline(pipeline);
+    sg_destroy_sampler(sampler);
+    sg_destroy_shader(shader);
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"textureAtlas\", \"sprites\": " << numSprites
+              << ", \"spriteImages\": " << numSpriteImages
+              << ", \"atlasPages\": " << atlas.getPageCount()
+              << ", \"atlasBuildMs\": " << atlasBuildMs
+              << ", \"direct\": {\"applyBindings\": " << directStats.num_apply_bindings << ", \"draws\": " << directStats.num_draw << ", \"frameMs\": " << directMs << "}"
+              << ", \"atlas\": {\"applyBindings\": " << atlasStats.num_apply_bindings << ", \"draws\": " << atlasStats.num_draw << ", \"frameMs\": " << atlasMs << "}}" << std::endl;
+}
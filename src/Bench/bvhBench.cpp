@@ -0,0 +1,138 @@
+#include"Bench.hpp"
+
+// Scene Sizes and Cube The Objects Are Scattered In
+static const size_t sceneSizes[] {100000, 1000000};
+static const float sceneHalfSize {500.0f};
+
+// Queries Timed Per Scene
+static const int numFrustumQueries {20};
+static const int numRays {100000};
+static const int numLinearRays {100};
+static const int numBoxQueries {100000};
+
+// BVH - Build, Refit and Query Throughput at 100k and 1M Objects, Against Linear Culling and Ray Casts
+void bench::bvh(void) {
+    sgl::JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 1u));
+    std::cout << "{\"benchmark\": \"bvh\", \"threads\": " << jobSystem.getThreadCount() << ", \"scenes\": [";
+    for(size_t scene {0}; scene < std::size(sceneSizes); scene++) {
+        const size_t numObjects {sceneSizes[scene]};
+
+        // Objects - Random Boxes in The Cube
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> positionDist(-sceneHalfSize, sceneHalfSize), sizeDist(0.5f, 2.0f), unitDist(-1.0f, 1.0f);
+        std::vector<sgl::AABB> bounds(numObjects);
+        sgl::AABBArray aabbs;
+        for(size_t i {0}; i < numObjects; i++) {
+            const glm::vec3 center {positionDist(rng), positionDist(rng), positionDist(rng)};
+            const glm::vec3 extents {sizeDist(rng), sizeDist(rng), sizeDist(rng)};
+            bounds[i] = {center - extents, center + extents};
+            aabbs.add(bounds[i]);
+        }
+
+        // Build - One Thread, Then Subtrees as Jobs
+        sgl::BVH bvh;
+        Clock::time_point start {Clock::now()};
+        bvh.build(bounds);
+        const double buildMs {msSince(start)};
+        start = Clock::now();
+        bvh.build(bounds, &jobSystem);
+        const double jobBuildMs {msSince(start)};
+        const float builtCost {bvh.getCost()};
+
+        // Refit - Every Object Moves a Little
+        for(size_t i {0}; i < numObjects; i++) {
+            const glm::vec3 offset {unitDist(rng), unitDist(rng), unitDist(rng)};
+            bvh.setBounds(static_cast<sgl::BVH::ProxyId>(i), {bounds[i].min + offset, bounds[i].max + offset});
+        }
+        start = Clock::now();
+        bvh.refit();
+        const double refitMs {msSince(start)};
+        bvh.build(bounds, &jobSystem);
+
+        // Frustum Queries - A Turning Camera at The Center, Against Linear SIMD Culling of The Same Boxes
+        sgl::Camera camera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), 1.0f, 1.0f, 70.0f, 1.0f, 120.0f);
+        camera.setAspectRatio(16.0f / 9.0f);
+        camera.setClipPlanes(0.1f, 1000.0f);
+        const auto frameFrustum = [&](const int &frame) {
+            const glm::vec3 front {glm::sin(frame * 0.3f), 0.0f, -glm::cos(frame * 0.3f)};
+            return sgl::Frustum(camera.getProjectionMat() * glm::lookAt(glm::vec3(0.0f), front, glm::vec3(0.0f, 1.0f, 0.0f)));
+        };
+        std::vector<sgl::BVH::ProxyId> results;
+        size_t bvhVisible {0};
+        start = Clock::now();
+        for(int frame {0}; frame < numFrustumQueries; frame++) {
+            results.clear();
+            bvhVisible += bvh.query(frameFrustum(frame), results);
+        }
+        const double frustumMs {msSince(start) / numFrustumQueries};
+        std::vector<uint8_t> visible;
+        size_t linearVisible {0};
+        start = Clock::now();
+        for(int frame {0}; frame < numFrustumQueries; frame++) {
+            linearVisible += frameFrustum(frame).cull(aabbs, visible);
+        }
+        const double linearFrustumMs {msSince(start) / numFrustumQueries};
+
+        // Ray Casts - Random Rays From Inside The Cube, Against Testing Every Box for a Few of Them
+        std::vector<std::pair<glm::vec3, glm::vec3>> rays(numRays);
+        for(std::pair<glm::vec3, glm::vec3> &ray : rays) {
+            ray = {glm::vec3(positionDist(rng), positionDist(rng), positionDist(rng)), glm::normalize(glm::vec3(unitDist(rng), unitDist(rng), unitDist(rng)) + glm::vec3(0.0f, 0.0f, 1e-3f))};
+        }
+        size_t numHits {0};
+        sgl::BVH::RayHit hit;
+        start = Clock::now();
+        for(const std::pair<glm::vec3, glm::vec3> &ray : rays) {
+            numHits += bvh.raycast(ray.first, ray.second, 2.0f * sceneHalfSize, hit);
+        }
+        const double rayMs {msSince(start)};
+        size_t numLinearHits {0};
+        start = Clock::now();
+        for(int i {0}; i < numLinearRays; i++) {
+            const glm::vec3 invDirection {1.0f / rays[i].second};
+            float closest {2.0f * sceneHalfSize};
+            for(const sgl::AABB &aabb : bounds) {
+                const glm::vec3 t0 {(aabb.min - rays[i].first) * invDirection}, t1 {(aabb.max - rays[i].first) * invDirection};
+                const glm::vec3 tNear {glm::min(t0, t1)}, tFar {glm::max(t0, t1)};
+                const float enter {std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f))};
+                if(enter <= std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, closest))) closest = enter;
+            }
+            numLinearHits += closest < 2.0f * sceneHalfSize;
+        }
+        const double linearRayMs {msSince(start)};
+
+        // Box Overlap Queries - Small Boxes Around Random Points
+        size_t numOverlaps {0};
+        start = Clock::now();
+        for(int i {0}; i < numBoxQueries; i++) {
+            const glm::vec3 center {positionDist(rng), positionDist(rng), positionDist(rng)};
+            results.clear();
+            numOverlaps += bvh.query(sgl::AABB {center - glm::vec3(5.0f), center + glm::vec3(5.0f)}, results);
+        }
+        const double boxMs {msSince(start)};
+
+        // Incremental Updates - Remove and Reinsert a Tenth of The Objects, Then Rebuild
+        const size_t numReinserted {numObjects / 10};
+        start = Clock::now();
+        for(size_t i {0}; i < numReinserted; i++) bvh.remove(static_cast<sgl::BVH::ProxyId>(i));
+        const double removeMs {msSince(start)};
+        start = Clock::now();
+        for(size_t i {0}; i < numReinserted; i++) bvh.insert(bounds[i]);
+        const double insertMs {msSince(start)};
+        const float insertedCost {bvh.getCost()};
+        start = Clock::now();
+        bvh.rebuild(&jobSystem);
+        const double rebuildMs {msSince(start)};
+
+        // Report Results - Query Rates Are Per Second, Visible Counts Per Frame Should Match Between The BVH and Linear Culling
+        std::cout << (scene > 0 ? ", " : "") << "{\"objects\": " << numObjects
+                  << ", \"buildMs\": " << buildMs << ", \"jobBuildMs\": " << jobBuildMs << ", \"refitMs\": " << refitMs
+                  << ", \"frustumMs\": " << frustumMs << ", \"linearFrustumMs\": " << linearFrustumMs
+                  << ", \"bvhVisible\": " << bvhVisible / numFrustumQueries << ", \"linearVisible\": " << linearVisible / numFrustumQueries
+                  << ", \"raysPerSec\": " << numRays / (rayMs / 1000.0) << ", \"linearRaysPerSec\": " << numLinearRays / (linearRayMs / 1000.0)
+                  << ", \"rayHitRate\": " << static_cast<double>(numHits) / numRays << ", \"linearRayHitRate\": " << static_cast<double>(numLinearHits) / numLinearRays
+                  << ", \"boxQueriesPerSec\": " << numBoxQueries / (boxMs / 1000.0) << ", \"overlapsPerQuery\": " << static_cast<double>(numOverlaps) / numBoxQueries
+                  << ", \"removeMs\": " << removeMs << ", \"insertMs\": " << insertMs << ", \"rebuildMs\": " << rebuildMs
+                  << ", \"builtCost\": " << builtCost << ", \"insertedCost\": " << insertedCost << "}";
+    }
+    std::cout << "]}" << std::endl;
+}
@@ -0,0 +1,92 @@
+#include"Bench.hpp"
+
+// Scene - Objects Scattered in a Cube Around The Camera
+static const size_t numObjects {1000000};
+static const float sceneHalfSize {500.0f};
+
+// Frames Timed Per Path - The Camera Turns Each Frame, The Average Is Reported
+static const int numFrames {20};
+
+// Culling - 1M Bounding Spheres and AABBs Against a Turning Camera's Frustum, Scalar vs SIMD vs SIMD on The Job System
+void bench::culling(void) {
+    // Objects - Spheres and Boxes With The Same Centers
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> positionDist(-sceneHalfSize, sceneHalfSize), sizeDist(0.5f, 2.0f);
+    std::vector<glm::vec4> sphereList(numObjects);
+    std::vector<sgl::AABB> aabbList(numObjects);
+    sgl::SphereArray spheres;
+    sgl::AABBArray aabbs;
+    for(size_t i {0}; i < numObjects; i++) {
+        const glm::vec3 center {positionDist(rng), positionDist(rng), positionDist(rng)};
+        const glm::vec3 extents {sizeDist(rng), sizeDist(rng), sizeDist(rng)};
+        sphereList[i] = glm::vec4(center, glm::length(extents));
+        aabbList[i] = {center - extents, center + extents};
+        spheres.add(center, sphereList[i].w);
+        aabbs.add(aabbList[i]);
+    }
+
+    // Camera - Turns Around Y Each Frame
+    sgl::Camera camera(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), 1.0f, 1.0f, 70.0f, 1.0f, 120.0f);
+    camera.setAspectRatio(16.0f / 9.0f);
+    camera.setClipPlanes(0.1f, 1000.0f);
+    const auto frameFrustum = [&](const int &frame) {
+        const glm::vec3 front {glm::sin(frame * 0.3f), 0.0f, -glm::cos(frame * 0.3f)};
+        return sgl::Frustum(camera.getProjectionMat() * glm::lookAt(glm::vec3(0.0f), front, glm::vec3(0.0f, 1.0f, 0.0f)));
+    };
+
+    // Run a Culling Path For numFrames - Returns Average Milliseconds and Total Visible Count
+    const auto runFrames = [&](const auto &cullFunc) {
+        size_t numVisible {0};
+        const Clock::time_point start {Clock::now()};
+        for(int frame {0}; frame < numFrames; frame++) {
+            numVisible += cullFunc(frameFrustum(frame));
+        }
+        return std::make_pair(msSince(start) / numFrames, numVisible);
+    };
+
+    // Scalar - One Object at a Time From Array-of-Structures Data
+    std::vector<uint8_t> visible(numObjects);
+    const std::pair<double, size_t> scalarSpheres {runFrames([&](const sgl::Frustum &frustum) {
+        size_t count {0};
+        for(size_t i {0}; i < numObjects; i++) {
+            visible[i] = frustum.intersects(glm::vec3(sphereList[i]), sphereList[i].w);
+            count += visible[i];
+        }
+        return count;
+    })};
+    const std::pair<double, size_t> scalarAABBs {runFrames([&](const sgl::Frustum &frustum) {
+        size_t count {0};
+        for(size_t i {0}; i < numObjects; i++) {
+            visible[i] = frustum.intersects(aabbList[i]);
+            count += visible[i];
+        }
+        return count;
+    })};
+
+    // SIMD - Structure-of-Arrays Batches
+    const std::pair<double, size_t> simdSpheres {runFrames([&](const sgl::Frustum &frustum) {return frustum.cull(spheres, visible);})};
+    const std::pair<double, size_t> simdAABBs {runFrames([&](const sgl::Frustum &frustum) {return frustum.cull(aabbs, visible);})};
+
+    // SIMD on Every Hardware Thread
+    sgl::JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 1u));
+    const std::pair<double, size_t> jobSpheres {runFrames([&](const sgl::Frustum &frustum) {return frustum.cull(spheres, visible, &jobSystem);})};
+    const std::pair<double, size_t> jobAABBs {runFrames([&](const sgl::Frustum &frustum) {return frustum.cull(aabbs, visible, &jobSystem);})};
+
+    // Report Results - Visible Counts Are Per Frame and Should Match Between Paths
+    const auto report = [](const char* name, const std::pair<double, size_t> &result, const bool &last) {
+        std::cout << "\"" << name << "\": {\"frameMs\": " << result.first << ", \"visible\": " << result.second / numFrames << "}" << (last ? "" : ", ");
+    };
+#if defined(__AVX__)
+    const char* simdWidth {"avx"};
+#else
+    const char* simdWidth {"sse"};
+#endif
+    std::cout << "{\"benchmark\": \"culling\", \"objects\": " << numObjects << ", \"simd\": \"" << simdWidth << "\", \"threads\": " << jobSystem.getThreadCount() << ", ";
+    report("scalarSpheres", scalarSpheres, false);
+    report("simdSpheres", simdSpheres, false);
+    report("jobSpheres", jobSpheres, false);
+    report("scalarAABBs", scalarAABBs, false);
+    report("simdAABBs", simdAABBs, false);
+    report("jobAABBs", jobAABBs, true);
+    std::cout << "}" << std::endl;
+}
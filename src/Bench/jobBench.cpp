@@ -0,0 +1,58 @@
+#include"Bench.hpp"
+
+// Workload - Model Matrices Rebuilt From Position, Rotation and Scale
+static const size_t numEntities {1000000};
+
+// Entities Per Job
+static const size_t grainSize {4096};
+
+// Updates Timed Per Thread Count - The Fastest Is Reported
+static const int numUpdates {10};
+
+// Job System Scaling - Transform Update For 1M Entities on sgl::JobSystem, 1 to N Threads
+void bench::jobScaling(void) {
+    // Entities - Random Position, Rotation Around Y and Uniform Scale
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    std::vector<glm::vec3> positions(numEntities);
+    std::vector<float> angles(numEntities), scales(numEntities);
+    for(size_t i {0}; i < numEntities; i++) {
+        positions[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        angles[i] = dist(rng);
+        scales[i] = 1.0f + std::abs(dist(rng)) * 0.01f;
+    }
+    std::vector<glm::mat4> modelMatrices(numEntities);
+
+    // Update Transforms in a Range
+    const auto updateRange = [&](const size_t &begin, const size_t &end) {
+        for(size_t i {begin}; i < end; i++) {
+            glm::mat4 modelMatrix {glm::translate(glm::mat4(1.0f), positions[i])};
+            modelMatrix = glm::rotate(modelMatrix, angles[i], glm::vec3(0.0f, 1.0f, 0.0f));
+            modelMatrices[i] = glm::scale(modelMatrix, glm::vec3(scales[i]));
+        }
+    };
+
+    // Thread Counts - Powers of Two Up to The Hardware Thread Count, Then The Hardware Thread Count Itself
+    const unsigned int maxThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+    std::vector<unsigned int> threadCounts;
+    for(unsigned int numThreads {1}; numThreads < maxThreads; numThreads *= 2) threadCounts.push_back(numThreads);
+    threadCounts.push_back(maxThreads);
+
+    // Run Each Thread Count
+    std::cout << "{\"benchmark\": \"jobScaling\", \"entities\": " << numEntities << ", \"grainSize\": " << grainSize << ", \"results\": [";
+    double singleThreadMs {0.0};
+    for(size_t i {0}; i < threadCounts.size(); i++) {
+        sgl::JobSystem jobSystem(threadCounts[i]);
+        jobSystem.parallelFor(numEntities, grainSize, updateRange);
+        double bestMs {0.0};
+        for(int update {0}; update < numUpdates; update++) {
+            const Clock::time_point start {Clock::now()};
+            jobSystem.parallelFor(numEntities, grainSize, updateRange);
+            const double ms {msSince(start)};
+            if(update == 0 || ms < bestMs) bestMs = ms;
+        }
+        if(i == 0) singleThreadMs = bestMs;
+        std::cout << (i == 0 ? "" : ", ") << "{\"threads\": " << threadCounts[i] << ", \"ms\": " << bestMs << ", \"speedup\": " << singleThreadMs / bestMs << "}";
+    }
+    std::cout << "]}" << std::endl;
+}
@@ -0,0 +1,62 @@
+#include"Bench.hpp"
+
+// Source Mesh - Bumpy UV Sphere, Its Longitude Seam and Poles Give The Simplifier Seams to Respect
+static const int sphereRings {256}, sphereSegments {512};
+
+// LOD Chain - Levels, Triangles Kept Per Level and Largest Error on Screen (One Pixel at 1080p)
+static const int lodLevels {8};
+static const float lodTriangleRatio {0.5f};
+static const float lodScreenError {1.0f / 1080.0f};
+
+// Scene - Objects Scattered Around The Camera's Path, Which Drifts Forward While Wobbling
+static const size_t numObjects {10000};
+static const float sceneRadius {1000.0f};
+static const int numFrames {300};
+
+// LOD - Chain Generation and Per-Object Selection While The Camera Moves, Triangles Drawn With and Without LODs
+void bench::lod(void) {
+    // Build LOD Chain
+    const sgl::MeshData sourceMesh {makeBumpySphere(sphereRings, sphereSegments)};
+    Clock::time_point start {Clock::now()};
+    const std::vector<sgl::MeshLOD> chain {sgl::buildLODChain(sourceMesh, lodLevels, lodTriangleRatio)};
+    const double chainMs {msSince(start)};
+
+    // Objects - Unit Spheres Scaled Up to 4x
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> positionDist(-sceneRadius, sceneRadius), scaleDist(1.0f, 4.0f);
+    sgl::SphereArray spheres;
+    const float meshRadius {glm::length(sourceMesh.getBounds().getExtents())};
+    for(size_t i {0}; i < numObjects; i++) {
+        spheres.add(glm::vec3(positionDist(rng), positionDist(rng), positionDist(rng)), meshRadius * scaleDist(rng));
+    }
+
+    // Select Levels Each Frame With and Without Hysteresis - The Wobble Makes Objects Near a Threshold Flip Back and Forth
+    const std::vector<float> screenSizes {sgl::LODSelector::makeScreenSizes(chain, lodScreenError)};
+    const sgl::LODSelector selector(screenSizes, 0.1f), noHysteresisSelector(screenSizes, 0.0f);
+    sgl::JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 1u));
+    std::vector<uint8_t> levels, noHysteresisLevels;
+    size_t lodTriangles {0}, changes {0}, noHysteresisChanges {0};
+    double selectMs {0.0};
+    for(int frame {0}; frame < numFrames; frame++) {
+        const glm::vec3 cameraPos {0.0f, 0.0f, sceneRadius * 0.5f - frame * 2.0f + glm::sin(frame * 0.7f) * 3.0f};
+        sgl::Camera camera(cameraPos, glm::vec3(0.0f, 0.0f, -1.0f), 1.0f, 1.0f, 70.0f, 1.0f, 120.0f);
+        start = Clock::now();
+        const size_t frameChanges {selector.select(camera, spheres, levels, &jobSystem)};
+        selectMs += msSince(start);
+        if(frame > 0) changes += frameChanges;
+        const size_t frameNoHysteresisChanges {noHysteresisSelector.select(camera, spheres, noHysteresisLevels)};
+        if(frame > 0) noHysteresisChanges += frameNoHysteresisChanges;
+        for(const uint8_t &level : levels) lodTriangles += chain[level].mesh.getTriangleCount();
+    }
+
+    // Report Results - Chain Levels, Then Per-Frame Averages
+    std::cout << "{\"benchmark\": \"lod\", \"chainMs\": " << chainMs << ", \"levels\": [";
+    for(size_t level {0}; level < chain.size(); level++) {
+        std::cout << (level > 0 ? ", " : "") << "{\"triangles\": " << chain[level].mesh.getTriangleCount() << ", \"vertices\": " << chain[level].mesh.getVertexCount()
+                  << ", \"error\": " << chain[level].error << ", \"screenSize\": " << (level > 0 ? screenSizes[level - 1] : 0.0f) << "}";
+    }
+    std::cout << "], \"objects\": " << numObjects << ", \"selectMs\": " << selectMs / numFrames
+              << ", \"fullTrianglesPerFrame\": " << numObjects * sourceMesh.getTriangleCount() << ", \"lodTrianglesPerFrame\": " << lodTriangles / numFrames
+              << ", \"changesPerFrame\": " << static_cast<double>(changes) / (numFrames - 1)
+              << ", \"noHysteresisChangesPerFrame\": " << static_cast<double>(noHysteresisChanges) / (numFrames - 1) << "}" << std::endl;
+}
@@ -0,0 +1,63 @@
+// Custom Engine Header - Built With SOKOL_DUMMY_BACKEND and SGL_HEADLESS
+#define SOKOL_IMPL
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_RECT_PACK_IMPLEMENTATION
+#include"Bench.hpp"
+
+// Benchmark Table
+struct Benchmark {
+    const char* name;
+    void (*run)(void);
+};
+static const Benchmark benchmarks[] {
+    {"textureLoad", bench::textureLoad},
+    {"textureAtlas", bench::textureAtlas},
+    {"renderQueue", bench::renderQueue},
+    {"uniforms", bench::uniforms},
+    {"materials", bench::materials},
+    {"jobScaling", bench::jobScaling},
+    {"transforms", bench::transforms},
+    {"sceneGraph", bench::sceneGraph},
+    {"culling", bench::culling},
+    {"bvh", bench::bvh},
+    {"lod", bench::lod},
+    {"meshLoad", bench::meshLoad},
+    {"meshOptimize", bench::meshOptimize},
+    {"shapes", bench::shapes},
+    {"triangles", bench::trianglesScene},
+    {"instanced", bench::instancedScene},
+    {"transient", bench::transientScene},
+};
+
+// Main - Run Every Benchmark, or Only Those Named on The Command Line (--frames N Sets Frames Per Scene, --trace DIR Writes Scene Traces)
+int main(int argc, char* argv[]) {
+    // Parse Command Line - Anything That Is Not an Option Is a Benchmark Name
+    std::vector<std::string> names;
+    for(int i {1}; i < argc; i++) {
+        const std::string arg {argv[i]};
+        if(arg == "--frames" && i + 1 < argc) {
+            bench::numSceneFrames = std::max(std::atoi(argv[++i]), 1);
+        } else if(arg == "--trace" && i + 1 < argc) {
+            bench::traceDirectory = argv[++i];
+        } else {
+            names.push_back(arg);
+        }
+    }
+
+    // Initialize Sokol - No Window or Render Context Required
+    sg_desc sokolSetupDesc {};
+    sokolSetupDesc.logger.func = slog_func;
+    sokolSetupDesc.image_pool_size = 4096;
+    sg_setup(&sokolSetupDesc);
+
+    // Run Benchmarks
+    for(const Benchmark &benchmark : benchmarks) {
+        if(names.empty() || std::find(names.begin(), names.end(), benchmark.name) != names.end()) benchmark.run();
+    }
+
+    // Shutdown Sokol
+    sg_shutdown();
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+#include"Bench.hpp"
+
+// Scene - Objects Per Material, Shuffled So Neighbouring Objects Rarely Share a Material
+static const int numMaterials {1000};
+static const int objectsPerMaterial {100};
+
+// Frames Rendered Per Measurement
+static const int numFrames {20};
+
+// Materials - Bindings and Pipeline Switches For 1000 Materials x 100 Objects, Immediate Draws in Scene Order vs sgl::Material Through sgl::RenderQueue
+void bench::materials(void) {
+    // Triangle Shared by Every Object
+    const sgl::BufferHandle vbo {makeTriangleVertexBuffer()}, ibo {makeTriangleIndexBuffer()};
+    sg_bindings meshBindings {};
+    meshBindings.vertex_buffers[0] = vbo.get();
+    meshBindings.index_buffer = ibo.get();
+
+    // Render State Shared by Every Material
+    sgl::ShaderRegistry surfaceShaders(surfaceShader_name, surfaceShaderPermutations.data(), surfaceShader_features, static_cast<uint32_t>(surfaceShaderPermutations.size()));
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.layout.attrs[ATTR_surfaceShader_0_surfaceVS_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+    pipelineDesc.layout.attrs[ATTR_surfaceShader_0_surfaceVS_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+
+    // Render Queue The Materials Submit Through - Declared First So It Outlives Them
+    sgl::RenderQueue renderQueue;
+
+    // Materials - Cycle Through The Non-Instanced Permutations, Each Has Its Own Texture and Tint
+    const uint32_t permutations[] {
+        0, FEATURE_surfaceShader_FOG, FEATURE_surfaceShader_ALPHA_TEST, FEATURE_surfaceShader_FOG | FEATURE_surfaceShader_ALPHA_TEST,
+    };
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    std::vector<sgl::ImageHandle> images;
+    std::vector<sgl::Material> materials;
+    std::vector<surfaceShader_0_surfaceMaterialUniforms_t> materialUniforms(numMaterials);
+    materials.reserve(numMaterials);
+    for(int i {0}; i < numMaterials; i++) {
+        sgl::Material &material {materials.emplace_back(surfaceShaders, permutations[i % std::size(permutations)], pipelineDesc)};
+        materialUniforms[i].tint = glm::vec4(static_cast<float>(i) / numMaterials, 1.0f, 1.0f, 1.0f);
+        material.setTexture(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceTexImg, images.emplace_back(sg_make_image(whiteImageDesc())).get(), SLOT_surfaceShader_0_surfaceTexSmp, sampler.get());
+        material.setUniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceMaterialUniforms, SG_RANGE(materialUniforms[i]));
+    }
+
+    // Hand-Built Bindings For The Immediate Path - What Every Object Had to Fill In Before Materials
+    std::vector<sg_bindings> bindings(numMaterials, meshBindings);
+    for(int i {0}; i < numMaterials; i++) {
+        bindings[i].fs.images[SLOT_surfaceShader_0_surfaceTexImg] = images[i].get();
+        bindings[i].fs.samplers[SLOT_surfaceShader_0_surfaceTexSmp] = sampler.get();
+    }
+
+    // Objects - Material, Depth and Model Matrix, in Shuffled Scene Order
+    const int numObjects {numMaterials * objectsPerMaterial};
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+    std::vector<int> objectMaterials(numObjects);
+    std::vector<float> objectDepths(numObjects);
+    std::vector<surfaceShader_0_surfaceObjectUniforms_t> objectUniforms(numObjects);
+    for(int i {0}; i < numObjects; i++) {
+        objectMaterials[i] = i % numMaterials;
+        objectDepths[i] = unitDist(rng);
+        objectUniforms[i].model = glm::translate(glm::mat4(1.0f), glm::vec3(unitDist(rng), unitDist(rng), unitDist(rng)) * 100.0f);
+    }
+    std::shuffle(objectMaterials.begin(), objectMaterials.end(), rng);
+    surfaceShader_0_surfaceFrameUniforms_t frameUniforms {};
+    frameUniforms.viewProj = glm::mat4(1.0f);
+    sg_pass_action passAction {};
+
+    // Immediate Draws in Scene Order - State Only Re-Applied When It Changes
+    Clock::time_point start {Clock::now()};
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        int currentMaterial {-1};
+        uint32_t currentPipeline {SG_INVALID_ID};
+        for(int i {0}; i < numObjects; i++) {
+            const int materialIndex {objectMaterials[i]};
+            const sg_pipeline pipeline {materials[materialIndex].getPipeline()};
+            if(pipeline.id != currentPipeline) {
+                sg_apply_pipeline(pipeline);
+                sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceFrameUniforms, SG_RANGE(frameUniforms));
+                currentPipeline = pipeline.id;
+                currentMaterial = -1;
+            }
+            if(materialIndex != currentMaterial) {
+                sg_apply_bindings(bindings[materialIndex]);
+                sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceMaterialUniforms, SG_RANGE(materialUniforms[materialIndex]));
+                currentMaterial = materialIndex;
+            }
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceObjectUniforms, SG_RANGE(objectUniforms[i]));
+            sg_draw(0, 3, 1);
+        }
+        sg_end_pass();
+        sg_commit();
+    }
+    const double directMs {msSince(start)};
+    const sg_frame_stats directStats {sg_query_frame_stats()};
+
+    // Materials Through The Render Queue - Sorted by Pipeline Then Bindings, So Each Material's Objects Draw Together
+    start = Clock::now();
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        const uint32_t frameUniformsId {renderQueue.addUniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceFrameUniforms, SG_RANGE(frameUniforms))};
+        for(int i {0}; i < numObjects; i++) {
+            sgl::DrawPacket packet;
+            packet.numElements = 3;
+            packet.frameUniformsId = frameUniformsId;
+            packet.vsUniformSlot = SLOT_surfaceShader_0_surfaceObjectUniforms;
+            materials[objectMaterials[i]].submit(renderQueue, packet, meshBindings, objectDepths[i], SG_RANGE(objectUniforms[i]));
+        }
+        renderQueue.flush();
+        sg_end_pass();
+        sg_commit();
+    }
+    const double queueMs {msSince(start)};
+    const sg_frame_stats queueStats {sg_query_frame_stats()};
+    size_t bindingsBuilt {0};
+    for(sgl::Material &material : materials) {
+        bindingsBuilt += material.getBindingsCount();
+    }
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"materials\", \"materials\": " << numMaterials
+              << ", \"objects\": " << numObjects
+              << ", \"pipelines\": " << surfaceShaders.getPipelineMisses()
+              << ", \"direct\": {\"drawsPerSec\": " << numObjects * numFrames / (directMs / 1000.0)
+              << ", \"applyPipeline\": " << directStats.num_apply_pipeline << ", \"applyBindings\": " << directStats.num_apply_bindings
+              << ", \"applyUniforms\": " << directStats.num_apply_uniforms << "}"
+              << ", \"materials\": {\"drawsPerSec\": " << numObjects * numFrames / (queueMs / 1000.0)
+              << ", \"applyPipeline\": " << queueStats.num_apply_pipeline << ", \"applyBindings\": " << queueStats.num_apply_bindings
+              << ", \"applyUniforms\": " << queueStats.num_apply_uniforms << ", \"bindingsBuilt\": " << bindingsBuilt << "}}" << std::endl;
+}
@@ -0,0 +1,133 @@
+#include"Bench.hpp"
+
+// Standard Headers
+#include<fstream>
+#include<numeric>
+
+// Source Mesh - Bumpy UV Sphere Written Out as an OBJ File With Positions, Texture Coordinates and Normals
+static const int sphereRings {256}, sphereSegments {512};
+
+// Number of Times The Mesh Is Loaded Per Measurement
+static const int iterations {8};
+
+// Mesh Loading - Parsing an OBJ File vs Mapping Its Cooked Mesh Blob Straight Into GPU Buffers
+void bench::meshLoad(void) {
+    // Write Source OBJ File
+    const sgl::MeshData sourceMesh {makeBumpySphere(sphereRings, sphereSegments)};
+    const std::filesystem::path objFilePath {std::filesystem::temp_directory_path() / "sglMeshBench.obj"};
+    const std::filesystem::path meshBlobFilePath {std::filesystem::temp_directory_path() / ("sglMeshBench.obj" + std::string(sgl::meshBlobExtension))};
+    {
+        std::ofstream objFile(objFilePath);
+        for(const glm::vec3 &position : sourceMesh.positions) objFile << "v " << position.x << " " << position.y << " " << position.z << "\n";
+        for(const glm::vec2 &texCoord : sourceMesh.texCoords) objFile << "vt " << texCoord.x << " " << texCoord.y << "\n";
+        for(const glm::vec3 &normal : sourceMesh.normals) objFile << "vn " << normal.x << " " << normal.y << " " << normal.z << "\n";
+        for(size_t i {0}; i < sourceMesh.indices.size(); i += 3) {
+            objFile << "f";
+            for(size_t corner {i}; corner < i + 3; corner++) {
+                const uint32_t index {sourceMesh.indices[corner] + 1};
+                objFile << " " << index << "/" << index << "/" << index;
+            }
+            objFile << "\n";
+        }
+    }
+
+    // Parse - What Loading The OBJ File at Runtime Would Cost Before Any Upload
+    sgl::MeshData mesh;
+    Clock::time_point start {Clock::now()};
+    for(int i {0}; i < iterations; i++) {
+        sgl::loadOBJ(objFilePath.string(), mesh);
+    }
+    const double parseMs {msSince(start) / iterations};
+
+    // Cook Once, Then Map The Mesh Blob Into Vertex and Index Buffers
+    start = Clock::now();
+    sgl::writeMeshBlob(mesh, meshBlobFilePath.string());
+    const double cookMs {msSince(start)};
+    int numVertices {0}, numIndices {0};
+    start = Clock::now();
+    for(int i {0}; i < iterations; i++) {
+        const sgl::Mesh loadedMesh(meshBlobFilePath.string());
+        numVertices = loadedMesh.getNumVertices();
+        numIndices = loadedMesh.getNumIndices();
+    }
+    const double blobMs {msSince(start) / iterations};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"meshLoad\", \"vertices\": " << numVertices
+              << ", \"triangles\": " << numIndices / 3
+              << ", \"objBytes\": " << std::filesystem::file_size(objFilePath)
+              << ", \"blobBytes\": " << std::filesystem::file_size(meshBlobFilePath)
+              << ", \"objParseMs\": " << parseMs
+              << ", \"cookMs\": " << cookMs
+              << ", \"blobLoadMs\": " << blobMs
+              << ", \"speedup\": " << parseMs / blobMs << "}" << std::endl;
+    std::filesystem::remove(objFilePath);
+    std::filesystem::remove(meshBlobFilePath);
+}
+
+// Mesh Optimisation - ACMR and Bytes Per Vertex of an Exporter-Shuffled Mesh Before and After The meshCooker Passes
+void bench::meshOptimize(void) {
+    // Shuffle Triangle Order and Vertex Order, Like an Exporter That Ignores The GPU's Caches
+    sgl::MeshData mesh {makeBumpySphere(sphereRings, sphereSegments)};
+    std::mt19937 rng(1234);
+    std::vector<uint32_t> triangleOrder(mesh.getTriangleCount()), vertexOrder(mesh.getVertexCount());
+    std::iota(triangleOrder.begin(), triangleOrder.end(), 0);
+    std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+    std::shuffle(triangleOrder.begin(), triangleOrder.end(), rng);
+    std::shuffle(vertexOrder.begin(), vertexOrder.end(), rng);
+    sgl::MeshData shuffled {mesh};
+    for(size_t triangle {0}; triangle < triangleOrder.size(); triangle++) {
+        for(size_t corner {0}; corner < 3; corner++) {
+            shuffled.indices[triangle * 3 + corner] = vertexOrder[mesh.indices[triangleOrder[triangle] * 3 + corner]];
+        }
+    }
+    for(size_t vertex {0}; vertex < vertexOrder.size(); vertex++) {
+        shuffled.positions[vertexOrder[vertex]] = mesh.positions[vertex];
+        shuffled.normals[vertexOrder[vertex]] = mesh.normals[vertex];
+        shuffled.texCoords[vertexOrder[vertex]] = mesh.texCoords[vertex];
+    }
+    mesh = shuffled;
+    const float sourceACMR {sgl::getACMR(mesh)};
+    const size_t sourceVertices {mesh.getVertexCount()};
+
+    // Run Each Pass in meshCooker's Order
+    Clock::time_point start {Clock::now()};
+    sgl::optimizeVertexCache(mesh);
+    const double vertexCacheMs {msSince(start)};
+    const float vertexCacheACMR {sgl::getACMR(mesh)};
+    start = Clock::now();
+    sgl::optimizeOverdraw(mesh);
+    const double overdrawMs {msSince(start)};
+    const float overdrawACMR {sgl::getACMR(mesh)};
+    start = Clock::now();
+    sgl::optimizeVertexFetch(mesh);
+    const double vertexFetchMs {msSince(start)};
+
+    // Vertex Size as Floats and Quantized - Read Back From The Written Mesh Blobs
+    uint32_t vertexStrides[2] {0, 0};
+    uintmax_t blobBytes[2] {0, 0};
+    const std::filesystem::path meshBlobFilePath {std::filesystem::temp_directory_path() / ("sglMeshOptimizeBench" + std::string(sgl::meshBlobExtension))};
+    for(int quantize {0}; quantize < 2; quantize++) {
+        sgl::writeMeshBlob(mesh, meshBlobFilePath.string(), quantize == 1);
+        sgl::MappedFile meshBlob(meshBlobFilePath.string());
+        sgl::MeshBlobHeader header;
+        if(sgl::readMeshBlobHeader(meshBlob, header)) vertexStrides[quantize] = header.vertexStride;
+        blobBytes[quantize] = std::filesystem::file_size(meshBlobFilePath);
+    }
+    std::filesystem::remove(meshBlobFilePath);
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"meshOptimize\", \"triangles\": " << mesh.getTriangleCount()
+              << ", \"vertices\": " << sourceVertices
+              << ", \"fetchVertices\": " << mesh.getVertexCount()
+              << ", \"sourceACMR\": " << sourceACMR
+              << ", \"vertexCacheACMR\": " << vertexCacheACMR
+              << ", \"overdrawACMR\": " << overdrawACMR
+              << ", \"vertexCacheMs\": " << vertexCacheMs
+              << ", \"overdrawMs\": " << overdrawMs
+              << ", \"vertexFetchMs\": " << vertexFetchMs
+              << ", \"bytesPerVertex\": " << vertexStrides[0]
+              << ", \"quantizedBytesPerVertex\": " << vertexStrides[1]
+              << ", \"blobBytes\": " << blobBytes[0]
+              << ", \"quantizedBlobBytes\": " << blobBytes[1] << "}" << std::endl;
+}
@@ -0,0 +1,99 @@
+#include"Bench.hpp"
+
+// Scene - Draw Packets Spread Randomly Over Pipelines and Bindings
+static const int numPackets {100000};
+static const int numPipelines {16};
+static const int numBindings {256};
+
+// Frames Rendered Per Measurement
+static const int numFrames {20};
+
+// Render Queue - Draws Per Second and Skipped State Changes For 100k Draw Packets, Sorted vs Submission Order
+void bench::renderQueue(void) {
+    // Triangle Shared by Every Draw
+    const sgl::BufferHandle vbo {makeTriangleVertexBuffer()}, ibo {makeTriangleIndexBuffer()};
+
+    // Pipelines - Same Shader, Different Color Write Masks
+    sgl::ShaderHandle shader {sg_make_shader(testShaderDesc())};
+    sgl::PipelineCache pipelineCache;
+    std::vector<sg_pipeline> pipelines;
+    for(int i {0}; i < numPipelines; i++) {
+        sg_pipeline_desc pipelineDesc {};
+        pipelineDesc.shader = shader.get();
+        pipelineDesc.layout.attrs[ATTR_vs_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+        pipelineDesc.layout.attrs[ATTR_vs_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+        pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+        pipelineDesc.colors[0].write_mask = static_cast<sg_color_mask>(i + 1);
+        pipelines.push_back(pipelineCache.get(pipelineDesc));
+    }
+
+    // Bindings - Same Buffers, Different Images
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    std::vector<sgl::ImageHandle> images;
+    std::vector<sg_bindings> bindings;
+    sgl::RenderQueue renderQueue;
+    for(int i {0}; i < numBindings; i++) {
+        sg_bindings binding {};
+        binding.vertex_buffers[0] = vbo.get();
+        binding.index_buffer = ibo.get();
+        binding.fs.images[SLOT_testTexImg] = images.emplace_back(sg_make_image(whiteImageDesc())).get();
+        binding.fs.samplers[SLOT_testTexSmp] = sampler.get();
+        bindings.push_back(binding);
+        renderQueue.addBindings(binding);
+    }
+
+    // Draw Packets - Random Pipeline, Bindings and Depth
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> depthDist(0.0f, 1.0f);
+    std::vector<sgl::DrawPacket> packets(numPackets);
+    for(sgl::DrawPacket &packet : packets) {
+        packet.pipeline = pipelines[rng() % numPipelines];
+        packet.bindingsId = static_cast<uint32_t>(rng() % numBindings);
+        packet.sortKey = sgl::RenderQueue::makeSortKey(0, packet.pipeline, packet.bindingsId, depthDist(rng));
+        packet.numElements = 3;
+        packet.vsUniformSlot = SLOT_testVSUniforms;
+    }
+    testVSUniforms_t vsUniforms {};
+    sg_pass_action passAction {};
+
+    // Submission Order - Every Draw Applies Its Own Pipeline and Bindings
+    Clock::time_point start {Clock::now()};
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        for(const sgl::DrawPacket &packet : packets) {
+            sg_apply_pipeline(packet.pipeline);
+            sg_apply_bindings(bindings[packet.bindingsId]);
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, packet.vsUniformSlot, SG_RANGE(vsUniforms));
+            sg_draw(packet.baseElement, packet.numElements, packet.numInstances);
+        }
+        sg_end_pass();
+        sg_commit();
+    }
+    const double directMs {msSince(start)};
+    const sg_frame_stats directStats {sg_query_frame_stats()};
+
+    // Render Queue - Submit, Sort and Flush Every Frame
+    start = Clock::now();
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        for(const sgl::DrawPacket &packet : packets) {
+            renderQueue.submit(packet, SG_RANGE(vsUniforms));
+        }
+        renderQueue.flush();
+        sg_end_pass();
+        sg_commit();
+    }
+    const double queueMs {msSince(start)};
+    const sg_frame_stats queueStats {sg_query_frame_stats()};
+    const sgl::RenderQueue::Stats &stats {renderQueue.getStats()};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"renderQueue\", \"packets\": " << numPackets
+              << ", \"pipelines\": " << numPipelines
+              << ", \"bindings\": " << numBindings
+              << ", \"direct\": {\"drawsPerSec\": " << numPackets * numFrames / (directMs / 1000.0)
+              << ", \"applyPipeline\": " << directStats.num_apply_pipeline << ", \"applyBindings\": " << directStats.num_apply_bindings << "}"
+              << ", \"queue\": {\"drawsPerSec\": " << numPackets * numFrames / (queueMs / 1000.0)
+              << ", \"applyPipeline\": " << queueStats.num_apply_pipeline << ", \"applyBindings\": " << queueStats.num_apply_bindings
+              << ", \"pipelineSkipsPerFrame\": " << stats.pipelineSkips / numFrames << ", \"bindingsSkipsPerFrame\": " << stats.bindingsSkips / numFrames << "}}" << std::endl;
+}
@@ -0,0 +1,271 @@
+#include"Bench.hpp"
+
+// Triangles Scene - Number of Draws
+static const int numTriangles {10000};
+
+// Instanced Scene - Grid Size and Spacing
+static const int instanceGridSize {100};
+static const float instanceGridSpacing {1.0f};
+
+// Transient Scene - Sprites, Sprites Per Batch and Images Cycled Between Batches
+static const int numSprites {10000};
+static const int spritesPerBatch {256};
+static const int numSpriteImages {16};
+
+// Value at a Percentile of Sorted Samples - Nearest Rank
+static double percentile(const std::vector<double> &sortedSamples, const double &percent) {
+    const size_t rank {static_cast<size_t>(std::ceil(percent / 100.0 * sortedSamples.size()))};
+    return sortedSamples[std::clamp(rank, static_cast<size_t>(1), sortedSamples.size()) - 1];
+}
+
+// Run a Scene For numSceneFrames and Print Its CPU Frame Times and Per-Frame Average Sokol Stats as One JSON Object
+// The Frame Function Records Commands Inside The Default Pass, The Time Includes sg_commit
+template<typename FrameFunc> static void runScene(const char* name, FrameFunc frameFunc) {
+    // Render Frames - The Profiler Keeps Every Frame So It Can Be Written as a Trace
+    sgl::Profiler profiler(bench::numSceneFrames);
+    sg_pass_action passAction {};
+    for(int frame {0}; frame < bench::numSceneFrames; frame++) {
+        profiler.beginFrame();
+        {
+            SGL_PROFILE_SCOPE(profiler, "Record");
+            sg_begin_default_pass(passAction, 800, 600);
+            frameFunc(frame);
+            sg_end_pass();
+        }
+        {
+            SGL_PROFILE_SCOPE(profiler, "Commit");
+            sg_commit();
+        }
+        profiler.endFrame();
+    }
+
+    // Collect Frame Times and Accumulate Frame Stats
+    std::vector<double> frameMs;
+    sg_frame_stats totals {};
+    for(int framesAgo {profiler.getFrameCount() - 1}; framesAgo >= 0; framesAgo--) {
+        const sgl::Profiler::Frame &frame {*profiler.getFrame(framesAgo)};
+        frameMs.push_back(stm_ms(stm_diff(frame.end, frame.start)));
+        const sg_frame_stats &stats {frame.stats};
+        totals.num_apply_pipeline += stats.num_apply_pipeline;
+        totals.num_apply_bindings += stats.num_apply_bindings;
+        totals.num_apply_uniforms += stats.num_apply_uniforms;
+        totals.num_draw += stats.num_draw;
+        totals.num_update_buffer += stats.num_update_buffer;
+        totals.num_append_buffer += stats.num_append_buffer;
+        totals.size_apply_uniforms += stats.size_apply_uniforms;
+        totals.size_update_buffer += stats.size_update_buffer;
+        totals.size_append_buffer += stats.size_append_buffer;
+    }
+
+    // Write Trace
+    if(!bench::traceDirectory.empty()) {
+        profiler.writeChromeTrace(bench::traceDirectory / (std::string(name) + ".trace.json"));
+    }
+
+    // Frame Time Distribution
+    double totalMs {0.0};
+    for(const double &ms : frameMs) totalMs += ms;
+    std::sort(frameMs.begin(), frameMs.end());
+
+    // Report Results
+    const int frames {bench::numSceneFrames};
+    std::cout << "{\"benchmark\": \"" << name << "\", \"frames\": " << frames
+              << ", \"frameMs\": {\"mean\": " << totalMs / frames
+              << ", \"min\": " << frameMs.front()
+              << ", \"p50\": " << percentile(frameMs, 50.0)
+              << ", \"p90\": " << percentile(frameMs, 90.0)
+              << ", \"p99\": " << percentile(frameMs, 99.0)
+              << ", \"max\": " << frameMs.back() << "}"
+              << ", \"perFrame\": {\"draws\": " << totals.num_draw / frames
+              << ", \"applyPipeline\": " << totals.num_apply_pipeline / frames
+              << ", \"applyBindings\": " << totals.num_apply_bindings / frames
+              << ", \"applyUniforms\": " << totals.num_apply_uniforms / frames
+              << ", \"updateBuffer\": " << totals.num_update_buffer / frames
+              << ", \"appendBuffer\": " << totals.num_append_buffer / frames
+              << ", \"uniformBytes\": " << totals.size_apply_uniforms / frames
+              << ", \"updateBufferBytes\": " << totals.size_update_buffer / frames
+              << ", \"appendBufferBytes\": " << totals.size_append_buffer / frames << "}}" << std::endl;
+}
+
+// Triangles - 10k Individually Transformed Triangles Through sgl::RenderQueue
+void bench::trianglesScene(void) {
+    // Triangle Buffers
+    const sgl::BufferHandle vbo {makeTriangleVertexBuffer()}, ibo {makeTriangleIndexBuffer()};
+
+    // Pipeline and Bindings
+    sgl::ShaderHandle shader {sg_make_shader(testShaderDesc())};
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.shader = shader.get();
+    pipelineDesc.layout.attrs[ATTR_vs_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+    pipelineDesc.layout.attrs[ATTR_vs_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+    pipelineDesc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
+    pipelineDesc.depth.write_enabled = true;
+    sgl::PipelineHandle pipeline {sg_make_pipeline(pipelineDesc)};
+    sgl::ImageHandle image {sg_make_image(whiteImageDesc())};
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    sg_bindings bindings {};
+    bindings.vertex_buffers[0] = vbo.get();
+    bindings.index_buffer = ibo.get();
+    bindings.fs.images[SLOT_testTexImg] = image.get();
+    bindings.fs.samplers[SLOT_testTexSmp] = sampler.get();
+    sgl::RenderQueue renderQueue;
+    const uint32_t bindingsId {renderQueue.addBindings(bindings)};
+
+    // Triangle Positions - Random Within a Box in Front of The Camera
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> positionDist(-50.0f, 50.0f);
+    std::vector<glm::vec3> positions(numTriangles);
+    for(glm::vec3 &position : positions) {
+        position = glm::vec3(positionDist(rng), positionDist(rng), positionDist(rng) - 100.0f);
+    }
+
+    // Every Frame - Spin Each Triangle and Submit One Packet With Its Own Uniforms
+    const glm::mat4 projectionMatrix {glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 1000.0f)};
+    testVSUniforms_t vsUniforms {};
+    runScene("triangles", [&](const int &frame) {
+        const float angle {frame * 0.01f};
+        for(const glm::vec3 &position : positions) {
+            const glm::mat4 modelMatrix {glm::rotate(glm::translate(glm::mat4(1.0f), position), angle, glm::vec3(0.0f, 1.0f, 0.0f))};
+            vsUniforms.pvm = projectionMatrix * modelMatrix;
+            sgl::DrawPacket packet {};
+            packet.pipeline = pipeline.get();
+            packet.bindingsId = bindingsId;
+            packet.sortKey = sgl::RenderQueue::makeSortKey(0, packet.pipeline, bindingsId, -position.z / 1000.0f);
+            packet.numElements = 3;
+            packet.vsUniformSlot = SLOT_testVSUniforms;
+            renderQueue.submit(packet, SG_RANGE(vsUniforms));
+        }
+        renderQueue.flush();
+    });
+}
+
+// Instanced - 100x100 Grid of Triangles in One Instanced Draw Through sgl::InstanceBuffer
+void bench::instancedScene(void) {
+    // Triangle Buffers and Instance Buffer
+    const sgl::BufferHandle vbo {makeTriangleVertexBuffer()}, ibo {makeTriangleIndexBuffer()};
+    sgl::InstanceBuffer instanceBuffer(instanceGridSize * instanceGridSize);
+
+    // Pipeline and Bindings
+    sgl::ShaderHandle shader {sg_make_shader(surfaceShaderDesc(FEATURE_surfaceShader_INSTANCING))};
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.shader = shader.get();
+    pipelineDesc.layout.attrs[ATTR_surfaceShader_1_surfaceVS_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+    pipelineDesc.layout.attrs[ATTR_surfaceShader_1_surfaceVS_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    pipelineDesc.layout.attrs[ATTR_surfaceShader_1_surfaceVS_textureCoords].offset = 3 * sizeof(float);
+    sgl::InstanceBuffer::setLayout(pipelineDesc, 1, ATTR_surfaceShader_1_surfaceVS_instanceModel0);
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+    pipelineDesc.depth.compare = SG_COMPAREFUNC_LESS_EQUAL;
+    pipelineDesc.depth.write_enabled = true;
+    sgl::PipelineHandle pipeline {sg_make_pipeline(pipelineDesc)};
+    sgl::ImageHandle image {sg_make_image(whiteImageDesc())};
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    sg_bindings bindings {};
+    bindings.vertex_buffers[0] = vbo.get();
+    bindings.vertex_buffers[1] = instanceBuffer.getBuffer();
+    bindings.index_buffer = ibo.get();
+    bindings.fs.images[SLOT_surfaceShader_1_surfaceTexImg] = image.get();
+    bindings.fs.samplers[SLOT_surfaceShader_1_surfaceTexSmp] = sampler.get();
+
+    // Every Frame - Rebuild and Upload The Grid's Model Matrices, Then One Instanced Draw
+    const glm::mat4 projectionMatrix {glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 1000.0f)};
+    surfaceShader_1_surfaceFrameUniforms_t frameUniforms {};
+    frameUniforms.viewProj = projectionMatrix * glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -150.0f));
+    surfaceShader_1_surfaceMaterialUniforms_t materialUniforms {};
+    materialUniforms.tint = glm::vec4(1.0f);
+    runScene("instanced", [&](const int &frame) {
+        const float angle {frame * 0.01f};
+        const float gridOffset {(instanceGridSize - 1) * instanceGridSpacing * 0.5f};
+        for(int x {0}; x < instanceGridSize; x++) {
+            for(int y {0}; y < instanceGridSize; y++) {
+                const glm::vec3 position {x * instanceGridSpacing - gridOffset, y * instanceGridSpacing - gridOffset, 0.0f};
+                instanceBuffer.add(glm::rotate(glm::translate(glm::mat4(1.0f), position), angle, glm::vec3(0.0f, 1.0f, 0.0f)));
+            }
+        }
+        instanceBuffer.upload();
+        sg_apply_pipeline(pipeline.get());
+        sg_apply_bindings(bindings);
+        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_1_surfaceFrameUniforms, SG_RANGE(frameUniforms));
+        sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_1_surfaceMaterialUniforms, SG_RANGE(materialUniforms));
+        sg_draw(0, 3, instanceBuffer.getInstanceCount());
+    });
+}
+
+// Transient - 10k Sprites Rebuilt Every Frame Into sgl::TransientBuffer, Drawn in Batches
+void bench::transientScene(void) {
+    // Shared Quad Index Buffer For One Batch
+    std::vector<uint16_t> quadIndices;
+    for(int i {0}; i < spritesPerBatch; i++) {
+        const uint16_t base {static_cast<uint16_t>(i * 4)};
+        for(const uint16_t index : {0, 1, 2, 0, 2, 3}) quadIndices.push_back(base + index);
+    }
+    sg_buffer_desc iboDesc {};
+    iboDesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    iboDesc.data = {quadIndices.data(), quadIndices.size() * sizeof(uint16_t)};
+    sgl::BufferHandle ibo {sg_make_buffer(iboDesc)};
+
+    // Transient Vertex Buffer - Deliberately Small So The First Frame Spills and Grows
+    sgl::TransientBuffer transientBuffer(SG_BUFFERTYPE_VERTEXBUFFER, 64 * 1024);
+
+    // Pipeline and One Image Per Batch
+    sgl::ShaderHandle shader {sg_make_shader(testShaderDesc())};
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.shader = shader.get();
+    pipelineDesc.layout.attrs[ATTR_vs_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+    pipelineDesc.layout.attrs[ATTR_vs_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+    sgl::PipelineHandle pipeline {sg_make_pipeline(pipelineDesc)};
+    std::vector<sgl::ImageHandle> images;
+    for(int i {0}; i < numSpriteImages; i++) images.emplace_back(sg_make_image(whiteImageDesc()));
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+
+    // Sprite Positions and Velocities
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<glm::vec2> positions(numSprites), velocities(numSprites);
+    for(int i {0}; i < numSprites; i++) {
+        positions[i] = glm::vec2(dist(rng), dist(rng));
+        velocities[i] = glm::vec2(dist(rng), dist(rng)) * 0.01f;
+    }
+
+    // Every Frame - Move Sprites, Write Each Batch's Quads and Draw It From Its Transient Allocation
+    std::vector<float> batchVertices;
+    testVSUniforms_t vsUniforms {};
+    vsUniforms.pvm = glm::mat4(1.0f);
+    const float halfSize {0.01f};
+    runScene("transient", [&](const int &frame) {
+        transientBuffer.beginFrame();
+        sg_apply_pipeline(pipeline.get());
+        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_testVSUniforms, SG_RANGE(vsUniforms));
+        for(int first {0}; first < numSprites; first += spritesPerBatch) {
+            // Build Batch Vertices
+            const int count {std::min(spritesPerBatch, numSprites - first)};
+            batchVertices.clear();
+            for(int i {first}; i < first + count; i++) {
+                positions[i] += velocities[i];
+                if(std::abs(positions[i].x) > 1.0f) velocities[i].x = -velocities[i].x;
+                if(std::abs(positions[i].y) > 1.0f) velocities[i].y = -velocities[i].y;
+                const glm::vec2 &p {positions[i]};
+                const float quad[4 * 5] {
+                    p.x - halfSize, p.y - halfSize, 0.0f, 0.0f, 0.0f,
+                    p.x + halfSize, p.y - halfSize, 0.0f, 1.0f, 0.0f,
+                    p.x + halfSize, p.y + halfSize, 0.0f, 1.0f, 1.0f,
+                    p.x - halfSize, p.y + halfSize, 0.0f, 0.0f, 1.0f,
+                };
+                batchVertices.insert(batchVertices.end(), quad, quad + 4 * 5);
+            }
+
+            // Append and Draw
+            const sgl::TransientAlloc transientAlloc {transientBuffer.alloc({batchVertices.data(), batchVertices.size() * sizeof(float)})};
+            if(transientAlloc.offset < 0) continue;
+            sg_bindings bindings {};
+            bindings.vertex_buffers[0] = transientAlloc.buffer;
+            bindings.vertex_buffer_offsets[0] = transientAlloc.offset;
+            bindings.index_buffer = ibo.get();
+            bindings.fs.images[SLOT_testTexImg] = images[(first / spritesPerBatch + frame) % numSpriteImages].get();
+            bindings.fs.samplers[SLOT_testTexSmp] = sampler.get();
+            sg_apply_bindings(bindings);
+            sg_draw(0, count * 6, 1);
+        }
+    });
+}
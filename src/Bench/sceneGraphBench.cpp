@@ -0,0 +1,58 @@
+#include"Bench.hpp"
+
+// Scene - Forest of Random Trees, Each Node's Parent Picked Among The Nodes of Its Tree Added Before It
+static const int numTrees {1000};
+static const int nodesPerTree {100};
+
+// Nodes Animated Per Frame in The Sparse Case
+static const int numAnimated {1000};
+
+// Frames Timed Per Case - The Average Is Reported
+static const int numFrames {20};
+
+// Scene Graph - Dirty Subtree Updates in a 100k Node Forest, a Few Animated Nodes vs Everything Dirty
+void bench::sceneGraph(void) {
+    // Build Forest - Unit Cubes Offset From Their Parents
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> offsetDist(-2.0f, 2.0f);
+    const sgl::AABB unitCube {glm::vec3(-0.5f), glm::vec3(0.5f)};
+    const glm::quat noRotation {1.0f, 0.0f, 0.0f, 0.0f};
+    sgl::SceneGraph sceneGraph;
+    std::vector<sgl::SceneGraph::NodeId> nodes, roots;
+    Clock::time_point start {Clock::now()};
+    for(int tree {0}; tree < numTrees; tree++) {
+        const size_t firstNode {nodes.size()};
+        for(int i {0}; i < nodesPerTree; i++) {
+            const sgl::SceneGraph::NodeId parent {i == 0 ? sgl::SceneGraph::invalidNode : nodes[firstNode + rng() % i]};
+            nodes.push_back(sceneGraph.addNode(parent, glm::vec3(offsetDist(rng), offsetDist(rng), offsetDist(rng)), noRotation, glm::vec3(1.0f), unitCube));
+        }
+        roots.push_back(nodes[firstNode]);
+    }
+    const double buildMs {msSince(start)};
+    sceneGraph.update();
+
+    // Animate Cases - Rotate Some Nodes, Then Update, Counting Nodes Recomputed
+    const auto runFrames = [&](const std::vector<sgl::SceneGraph::NodeId> &animated) {
+        size_t numUpdated {0};
+        const Clock::time_point framesStart {Clock::now()};
+        for(int frame {0}; frame < numFrames; frame++) {
+            const glm::quat rotation {glm::angleAxis(frame * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f))};
+            for(const sgl::SceneGraph::NodeId &node : animated) sceneGraph.setRotation(node, rotation);
+            numUpdated += sceneGraph.update();
+        }
+        return std::make_pair(msSince(framesStart) / numFrames, numUpdated / numFrames);
+    };
+
+    // Sparse - Random Nodes Anywhere in The Hierarchy
+    std::vector<sgl::SceneGraph::NodeId> sparseNodes;
+    for(int i {0}; i < numAnimated; i++) sparseNodes.push_back(nodes[rng() % nodes.size()]);
+    const std::pair<double, size_t> sparse {runFrames(sparseNodes)};
+
+    // Full - Every Root, So Every Node Is Recomputed
+    const std::pair<double, size_t> full {runFrames(roots)};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"sceneGraph\", \"nodes\": " << sceneGraph.getNodeCount() << ", \"buildMs\": " << buildMs
+              << ", \"sparse\": {\"animated\": " << numAnimated << ", \"nodesUpdated\": " << sparse.second << ", \"frameMs\": " << sparse.first << "}"
+              << ", \"full\": {\"nodesUpdated\": " << full.second << ", \"frameMs\": " << full.first << "}}" << std::endl;
+}
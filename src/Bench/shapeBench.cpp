@@ -0,0 +1,129 @@
+#include"Bench.hpp"
+
+// Scene - Objects Each Drawing One of a Few Distinct Procedural Shapes
+static const int numShapes {50};
+static const int numObjects {10000};
+
+// Frames Rendered Per Measurement
+static const int numFrames {20};
+
+// Shape Parameters - Kind (Plane, Box, Sphere, Cylinder, Torus), Sizes and Subdivisions
+struct ShapeParams {
+    int kind;
+    float sizes[3];
+    uint16_t divisions[2];
+};
+
+// Get Shape's Element Range From a Shape Cache
+static sshape_element_range_t getShape(sgl::ShapeCache &shapeCache, const ShapeParams &params) {
+    switch(params.kind) {
+        case 0: return shapeCache.getPlane(params.sizes[0], params.sizes[1], params.divisions[0]);
+        case 1: return shapeCache.getBox(params.sizes[0], params.sizes[1], params.sizes[2], params.divisions[0]);
+        case 2: return shapeCache.getSphere(params.sizes[0], params.divisions[0], params.divisions[1]);
+        case 3: return shapeCache.getCylinder(params.sizes[0], params.sizes[1], params.divisions[0], params.divisions[1]);
+        default: return shapeCache.getTorus(params.sizes[0], params.sizes[1], params.divisions[0], params.divisions[1]);
+    }
+}
+
+// Shapes - Draws Per Second and Bindings Applied For 10k Objects Drawing 50 Shapes, One Shared sgl::ShapeCache vs a Buffer Pair Per Shape
+void bench::shapes(void) {
+    // Distinct Shapes - Kinds in Turn, Random Sizes and Subdivisions
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> sizeDist(0.5f, 2.0f);
+    std::uniform_int_distribution<int> tilesDist(1, 4), slicesDist(8, 32), stacksDist(4, 16);
+    std::vector<ShapeParams> shapeParams(numShapes);
+    for(int i {0}; i < numShapes; i++) {
+        shapeParams[i] = {i % 5, {sizeDist(rng), sizeDist(rng) * 0.4f, sizeDist(rng)}, {static_cast<uint16_t>(i % 5 < 2 ? tilesDist(rng) : slicesDist(rng)), static_cast<uint16_t>(stacksDist(rng))}};
+    }
+
+    // Shared Cache - Every Shape in One Vertex/Index Buffer Pair
+    sgl::ShapeCache sharedCache(65536, 262144);
+    Clock::time_point start {Clock::now()};
+    for(const ShapeParams &params : shapeParams) {
+        getShape(sharedCache, params);
+    }
+    const double buildMs {msSince(start)};
+    sharedCache.upload();
+
+    // Separate Caches - Every Shape in Its Own Buffer Pair, Like Building Each Mesh by Hand
+    std::vector<std::unique_ptr<sgl::ShapeCache>> separateCaches;
+    for(const ShapeParams &params : shapeParams) {
+        separateCaches.push_back(std::make_unique<sgl::ShapeCache>(4096, 16384));
+        getShape(*separateCaches.back(), params);
+        separateCaches.back()->upload();
+    }
+
+    // Pipeline - Shape Positions and Texture Coordinates Into The Test Shader
+    sgl::ShaderHandle shader {sg_make_shader(testShaderDesc())};
+    sg_pipeline_desc pipelineDesc {};
+    pipelineDesc.shader = shader.get();
+    sgl::ShapeCache::setLayout(pipelineDesc, 0, ATTR_vs_vertexPosition, -1, ATTR_vs_textureCoords, -1);
+    sgl::PipelineHandle pipeline {sg_make_pipeline(pipelineDesc)};
+
+    // Bindings - One For The Shared Cache, One Per Separate Cache
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    sgl::ImageHandle image {sg_make_image(whiteImageDesc())};
+    sgl::RenderQueue renderQueue;
+    auto addBindings {[&](sgl::ShapeCache &shapeCache) {
+        sg_bindings bindings {};
+        bindings.vertex_buffers[0] = shapeCache.getVertexBuffer();
+        bindings.index_buffer = shapeCache.getIndexBuffer();
+        bindings.fs.images[SLOT_testTexImg] = image.get();
+        bindings.fs.samplers[SLOT_testTexSmp] = sampler.get();
+        return renderQueue.addBindings(bindings);
+    }};
+    const uint32_t sharedBindingsId {addBindings(sharedCache)};
+    std::vector<uint32_t> separateBindingsIds;
+    for(std::unique_ptr<sgl::ShapeCache> &separateCache : separateCaches) {
+        separateBindingsIds.push_back(addBindings(*separateCache));
+    }
+
+    // Objects - Random Shape and Depth
+    std::uniform_real_distribution<float> depthDist(0.0f, 1.0f);
+    std::vector<int> objectShapes(numObjects);
+    std::vector<float> objectDepths(numObjects);
+    for(int i {0}; i < numObjects; i++) {
+        objectShapes[i] = static_cast<int>(rng() % numShapes);
+        objectDepths[i] = depthDist(rng);
+    }
+    testVSUniforms_t vsUniforms {};
+    sg_pass_action passAction {};
+
+    // Draw Every Object Each Frame - Shared Looks Up Ranges in The Cache Every Frame, So Lookups Are Part of Its Time
+    auto drawFrames {[&](const bool &shared) {
+        renderQueue.resetStats();
+        const Clock::time_point drawStart {Clock::now()};
+        for(int frame {0}; frame < numFrames; frame++) {
+            sg_begin_default_pass(passAction, 800, 600);
+            for(int i {0}; i < numObjects; i++) {
+                const int shape {objectShapes[i]};
+                const sshape_element_range_t elementRange {getShape(shared ? sharedCache : *separateCaches[shape], shapeParams[shape])};
+                sgl::DrawPacket packet;
+                packet.pipeline = pipeline.get();
+                packet.bindingsId = shared ? sharedBindingsId : separateBindingsIds[shape];
+                packet.sortKey = sgl::RenderQueue::makeSortKey(0, packet.pipeline, packet.bindingsId, objectDepths[i]);
+                packet.baseElement = elementRange.base_element;
+                packet.numElements = elementRange.num_elements;
+                packet.vsUniformSlot = SLOT_testVSUniforms;
+                renderQueue.submit(packet, SG_RANGE(vsUniforms));
+            }
+            renderQueue.flush();
+            sg_end_pass();
+            sg_commit();
+        }
+        return msSince(drawStart);
+    }};
+    const double separateMs {drawFrames(false)};
+    const uint64_t separateApplies {renderQueue.getStats().bindingsApplies / numFrames};
+    const double sharedMs {drawFrames(true)};
+    const uint64_t sharedApplies {renderQueue.getStats().bindingsApplies / numFrames};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"shapes\", \"shapes\": " << sharedCache.getShapeCount()
+              << ", \"objects\": " << numObjects
+              << ", \"vertices\": " << sharedCache.getVertexCount()
+              << ", \"indices\": " << sharedCache.getIndexCount()
+              << ", \"buildMs\": " << buildMs
+              << ", \"separate\": {\"drawsPerSec\": " << numObjects * numFrames / (separateMs / 1000.0) << ", \"applyBindingsPerFrame\": " << separateApplies << "}"
+              << ", \"shared\": {\"drawsPerSec\": " << numObjects * numFrames / (sharedMs / 1000.0) << ", \"applyBindingsPerFrame\": " << sharedApplies << "}}" << std::endl;
+}
@@ -0,0 +1,76 @@
+#include"Bench.hpp"
+
+// Texture Image and Cooked Texture Blob Directories - Relative to The Build Directory Like The Main Executable
+static const std::string texImgDirPath {"../assets/textures"};
+static const std::string texBlobDirPath {"../assets/textures/cooked"};
+
+// Number of Times The Whole Texture Set Is Loaded Per Measurement
+static const int iterations {16};
+
+// Texture Loading - Serial Decode and Upload vs sgl::TextureLoader Worker Threads
+void bench::textureLoad(void) {
+    // Collect Texture Image Files
+    std::vector<std::string> texImgFilePaths;
+    for(const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(texImgDirPath)) {
+        if(entry.is_regular_file()) texImgFilePaths.push_back(entry.path().string());
+    }
+
+    // Texture Image Desc Shared by Every Texture
+    sg_image_desc imgDesc {};
+    imgDesc.type = SG_IMAGETYPE_2D;
+    imgDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    imgDesc.usage = SG_USAGE_IMMUTABLE;
+
+    // Serial - Decode and Create Every Texture on This Thread
+    std::vector<sgl::Texture> textures;
+    Clock::time_point start {Clock::now()};
+    for(int i {0}; i < iterations; i++) {
+        for(const std::string &texImgFilePath : texImgFilePaths) {
+            sg_image_desc texImgDesc {imgDesc};
+            textures.emplace_back(texImgDesc, texImgFilePath);
+        }
+    }
+    const double serialMs {msSince(start)};
+    textures.clear();
+
+    // Parallel - Decode on Worker Threads, Upload Here
+    const unsigned int numThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+    start = Clock::now();
+    {
+        sgl::TextureLoader texLoader(numThreads, SIZE_MAX);
+        for(int i {0}; i < iterations; i++) {
+            for(const std::string &texImgFilePath : texImgFilePaths) {
+                textures.emplace_back(texLoader, imgDesc, texImgFilePath);
+            }
+        }
+        texLoader.finish();
+    }
+    const double parallelMs {msSince(start)};
+    textures.clear();
+
+    // Cooked - Map Texture Blobs Written by scripts/cookTextures.sh, No Decode
+    std::vector<std::string> texBlobFilePaths;
+    if(std::filesystem::is_directory(texBlobDirPath)) {
+        for(const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(texBlobDirPath)) {
+            if(sgl::isTextureBlob(entry.path().string())) texBlobFilePaths.push_back(entry.path().string());
+        }
+    }
+    start = Clock::now();
+    for(int i {0}; i < iterations; i++) {
+        for(const std::string &texBlobFilePath : texBlobFilePaths) {
+            sg_image_desc texImgDesc {imgDesc};
+            textures.emplace_back(texImgDesc, texBlobFilePath);
+        }
+    }
+    const double cookedMs {msSince(start)};
+    textures.clear();
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"textureLoad\", \"textures\": " << texImgFilePaths.size() * iterations
+              << ", \"threads\": " << numThreads
+              << ", \"serialMs\": " << serialMs
+              << ", \"parallelMs\": " << parallelMs
+              << ", \"speedup\": " << serialMs / parallelMs
+              << ", \"cookedTextures\": " << texBlobFilePaths.size() * iterations
+              << ", \"cookedMs\": " << cookedMs << "}" << std::endl;
+}
@@ -0,0 +1,69 @@
+#include"Bench.hpp"
+
+// Workload - Every Entity Spins Every Frame
+static const size_t numEntities {1000000};
+
+// Frames Timed Per Path - The Average Is Reported
+static const int numFrames {10};
+
+// Transforms - 1M Transform Updates Per Frame, Naive Per-Object glm vs sgl::TransformStore
+void bench::transforms(void) {
+    // Entities - Random Position and Uniform Scale, Spinning Around Y
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    std::vector<glm::vec3> positions(numEntities);
+    std::vector<float> scales(numEntities);
+    for(size_t i {0}; i < numEntities; i++) {
+        positions[i] = glm::vec3(dist(rng), dist(rng), dist(rng));
+        scales[i] = 1.0f + std::abs(dist(rng)) * 0.01f;
+    }
+    const glm::mat4 projectionMatrix {glm::perspective(glm::radians(45.0f), 800.0f / 600.0f, 0.1f, 1000.0f)};
+    const glm::mat4 viewMatrix {glm::lookAt(glm::vec3(0.0f, 0.0f, 200.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f))};
+    std::vector<glm::mat4> pvmMatrices(numEntities);
+
+    // Naive - Rebuild Each Model Matrix With glm::rotate and Multiply by Projection and View Per Object, as main.cpp Did
+    Clock::time_point start {Clock::now()};
+    for(int frame {0}; frame < numFrames; frame++) {
+        const float angle {frame * 0.01f};
+        for(size_t i {0}; i < numEntities; i++) {
+            glm::mat4 modelMatrix {glm::translate(glm::mat4(1.0f), positions[i])};
+            modelMatrix = glm::rotate(modelMatrix, angle, glm::vec3(0.0f, 1.0f, 0.0f));
+            modelMatrix = glm::scale(modelMatrix, glm::vec3(scales[i]));
+            pvmMatrices[i] = projectionMatrix * viewMatrix * modelMatrix;
+        }
+    }
+    const double naiveMs {msSince(start) / numFrames};
+
+    // Transform Store - Set Rotations on Every dirtyStride'th Entity and Update Dirty World Matrices
+    // The View-Projection Is Multiplied Once Per Frame and Applied on The GPU, Unless CPU Matrices Are Requested
+    sgl::TransformStore transformStore;
+    for(size_t i {0}; i < numEntities; i++) {
+        transformStore.add(positions[i], glm::quat(1.0f, 0.0f, 0.0f, 0.0f), glm::vec3(scales[i]));
+    }
+    const auto runStore = [&](sgl::JobSystem* jobSystem, const uint32_t &dirtyStride, const bool &cpuViewProj) {
+        const Clock::time_point storeStart {Clock::now()};
+        for(int frame {0}; frame < numFrames; frame++) {
+            const glm::quat rotation {glm::angleAxis(frame * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f))};
+            for(uint32_t i {0}; i < numEntities; i += dirtyStride) transformStore.setRotation(i, rotation);
+            transformStore.update(jobSystem);
+            const glm::mat4 viewProjMatrix {projectionMatrix * viewMatrix};
+            if(cpuViewProj) sgl::TransformStore::multiply(viewProjMatrix, transformStore.getWorldMatrices(), pvmMatrices.data(), numEntities);
+        }
+        return msSince(storeStart) / numFrames;
+    };
+    const double storeMs {runStore(nullptr, 1, false)};
+    const double storeTenthMs {runStore(nullptr, 10, false)};
+    const double storeCpuViewProjMs {runStore(nullptr, 1, true)};
+
+    // Transform Store With Local Matrices Built on Every Hardware Thread
+    sgl::JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), 1u));
+    const double storeJobsMs {runStore(&jobSystem, 1, false)};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"transforms\", \"entities\": " << numEntities
+              << ", \"naive\": {\"frameMs\": " << naiveMs << "}"
+              << ", \"store\": {\"frameMs\": " << storeMs << ", \"speedup\": " << naiveMs / storeMs << "}"
+              << ", \"storeTenthDirty\": {\"frameMs\": " << storeTenthMs << ", \"speedup\": " << naiveMs / storeTenthMs << "}"
+              << ", \"storeCpuViewProj\": {\"frameMs\": " << storeCpuViewProjMs << ", \"speedup\": " << naiveMs / storeCpuViewProjMs << "}"
+              << ", \"storeJobs\": {\"threads\": " << jobSystem.getThreadCount() << ", \"frameMs\": " << storeJobsMs << ", \"speedup\": " << naiveMs / storeJobsMs << "}}" << std::endl;
+}
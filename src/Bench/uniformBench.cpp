@@ -0,0 +1,129 @@
+#include"Bench.hpp"
+
+// Scene - Draw Packets Spread Randomly Over Pipelines and Materials, Each Material Has Its Own Bindings and Tint
+static const int numPackets {100000};
+static const int numPipelines {16};
+static const int numMaterials {64};
+
+// Frames Rendered Per Measurement
+static const int numFrames {20};
+
+// Uniforms - Frame, Material and Object Blocks Applied Every Draw vs Through sgl::RenderQueue's sgl::UniformManager
+void bench::uniforms(void) {
+    // Triangle Shared by Every Draw
+    const sgl::BufferHandle vbo {makeTriangleVertexBuffer()}, ibo {makeTriangleIndexBuffer()};
+
+    // Pipelines - Same Surface Shader Permutation, Different Color Write Masks
+    sgl::ShaderHandle shader {sg_make_shader(surfaceShaderDesc())};
+    sgl::PipelineCache pipelineCache;
+    std::vector<sg_pipeline> pipelines;
+    for(int i {0}; i < numPipelines; i++) {
+        sg_pipeline_desc pipelineDesc {};
+        pipelineDesc.shader = shader.get();
+        pipelineDesc.layout.attrs[ATTR_surfaceShader_0_surfaceVS_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
+        pipelineDesc.layout.attrs[ATTR_surfaceShader_0_surfaceVS_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
+        pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+        pipelineDesc.colors[0].write_mask = static_cast<sg_color_mask>(i + 1);
+        pipelines.push_back(pipelineCache.get(pipelineDesc));
+    }
+
+    // Materials - Bindings (Same Buffers, Different Images) and Tint
+    const sgl::SamplerHandle sampler {makeDefaultSampler()};
+    std::vector<sgl::ImageHandle> images;
+    std::vector<sg_bindings> bindings;
+    std::vector<surfaceShader_0_surfaceMaterialUniforms_t> materialUniforms(numMaterials);
+    sgl::RenderQueue renderQueue;
+    for(int i {0}; i < numMaterials; i++) {
+        sg_bindings binding {};
+        binding.vertex_buffers[0] = vbo.get();
+        binding.index_buffer = ibo.get();
+        binding.fs.images[SLOT_surfaceShader_0_surfaceTexImg] = images.emplace_back(sg_make_image(whiteImageDesc())).get();
+        binding.fs.samplers[SLOT_surfaceShader_0_surfaceTexSmp] = sampler.get();
+        bindings.push_back(binding);
+        renderQueue.addBindings(binding);
+        materialUniforms[i].tint = glm::vec4(static_cast<float>(i) / numMaterials, 1.0f, 1.0f, 1.0f);
+    }
+
+    // Draw Packets - Random Pipeline, Material and Depth, Each With Its Own Model Matrix
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+    std::vector<sgl::DrawPacket> packets(numPackets);
+    std::vector<surfaceShader_0_surfaceObjectUniforms_t> objectUniforms(numPackets);
+    for(int i {0}; i < numPackets; i++) {
+        sgl::DrawPacket &packet {packets[i]};
+        packet.pipeline = pipelines[rng() % numPipelines];
+        packet.bindingsId = static_cast<uint32_t>(rng() % numMaterials);
+        packet.sortKey = sgl::RenderQueue::makeSortKey(0, packet.pipeline, packet.bindingsId, unitDist(rng));
+        packet.numElements = 3;
+        packet.vsUniformSlot = SLOT_surfaceShader_0_surfaceObjectUniforms;
+        objectUniforms[i].model = glm::translate(glm::mat4(1.0f), glm::vec3(unitDist(rng), unitDist(rng), unitDist(rng)) * 100.0f);
+    }
+    surfaceShader_0_surfaceFrameUniforms_t frameUniforms {};
+    frameUniforms.viewProj = glm::mat4(1.0f);
+    sg_pass_action passAction {};
+
+    // Every Block Every Draw - Packets in Sorted Order So Only The Uniform Handling Differs
+    std::vector<uint32_t> sortedPackets(numPackets);
+    for(int i {0}; i < numPackets; i++) sortedPackets[i] = static_cast<uint32_t>(i);
+    std::sort(sortedPackets.begin(), sortedPackets.end(), [&](const uint32_t &a, const uint32_t &b) {return packets[a].sortKey < packets[b].sortKey;});
+    Clock::time_point start {Clock::now()};
+    for(int frame {0}; frame < numFrames; frame++) {
+        sg_begin_default_pass(passAction, 800, 600);
+        uint32_t currentPipeline {SG_INVALID_ID}, currentBindings {UINT32_MAX};
+        for(const uint32_t &packetIndex : sortedPackets) {
+            const sgl::DrawPacket &packet {packets[packetIndex]};
+            if(packet.pipeline.id != currentPipeline) {
+                sg_apply_pipeline(packet.pipeline);
+                currentPipeline = packet.pipeline.id;
+                currentBindings = UINT32_MAX;
+            }
+            if(packet.bindingsId != currentBindings) {
+                sg_apply_bindings(bindings[packet.bindingsId]);
+                currentBindings = packet.bindingsId;
+            }
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceFrameUniforms, SG_RANGE(frameUniforms));
+            sg_apply_uniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceMaterialUniforms, SG_RANGE(materialUniforms[packet.bindingsId]));
+            sg_apply_uniforms(SG_SHADERSTAGE_VS, packet.vsUniformSlot, SG_RANGE(objectUniforms[packetIndex]));
+            sg_draw(packet.baseElement, packet.numElements, packet.numInstances);
+        }
+        sg_end_pass();
+        sg_commit();
+    }
+    const double directMs {msSince(start)};
+    const sg_frame_stats directStats {sg_query_frame_stats()};
+
+    // Render Queue - Frame and Material Blocks Added Once Per Frame, Unchanged Blocks Skipped by The Uniform Manager
+    sgl::UniformManager &uniformManager {renderQueue.getUniformManager()};
+    start = Clock::now();
+    for(int frame {0}; frame < numFrames; frame++) {
+        uniformManager.beginFrame();
+        sg_begin_default_pass(passAction, 800, 600);
+        const uint32_t frameUniformsId {renderQueue.addUniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceFrameUniforms, SG_RANGE(frameUniforms))};
+        uint32_t materialUniformsIds[numMaterials];
+        for(int i {0}; i < numMaterials; i++) {
+            materialUniformsIds[i] = renderQueue.addUniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceMaterialUniforms, SG_RANGE(materialUniforms[i]));
+        }
+        for(int i {0}; i < numPackets; i++) {
+            sgl::DrawPacket packet {packets[i]};
+            packet.frameUniformsId = frameUniformsId;
+            packet.materialUniformsId = materialUniformsIds[packet.bindingsId];
+            renderQueue.submit(packet, SG_RANGE(objectUniforms[i]));
+        }
+        renderQueue.flush();
+        sg_end_pass();
+        sg_commit();
+    }
+    const double queueMs {msSince(start)};
+    const sg_frame_stats queueStats {sg_query_frame_stats()};
+    const sgl::UniformManager::Stats &stats {uniformManager.getStats()};
+
+    // Report Results
+    std::cout << "{\"benchmark\": \"uniforms\", \"packets\": " << numPackets
+              << ", \"pipelines\": " << numPipelines
+              << ", \"materials\": " << numMaterials
+              << ", \"direct\": {\"drawsPerSec\": " << numPackets * numFrames / (directMs / 1000.0)
+              << ", \"applyUniforms\": " << directStats.num_apply_uniforms << ", \"uniformBytesPerFrame\": " << directStats.size_apply_uniforms << "}"
+              << ", \"queue\": {\"drawsPerSec\": " << numPackets * numFrames / (queueMs / 1000.0)
+              << ", \"applyUniforms\": " << queueStats.num_apply_uniforms << ", \"uniformBytesPerFrame\": " << uniformManager.getPeakFrameBytes()
+              << ", \"uniformSkipsPerFrame\": " << stats.skips / numFrames << ", \"bytesSkippedPerFrame\": " << stats.bytesSkipped / numFrames << "}}" << std::endl;
+}
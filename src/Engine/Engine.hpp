@@ -3,34 +3,1435 @@
 // Standard Headers
 #include<iostream>
 #include<cstdlib>
+#include<cstdint>
+#include<cstring>
+#include<cmath>
+#include<bit>
+#include<memory>
+#include<utility>
+#include<filesystem>
+#include<algorithm>
+#include<string>
+#include<deque>
+#include<list>
+#include<set>
+#include<vector>
+#include<unordered_map>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<functional>
+#include<chrono>
 
 // Sokol
 #include<sokol_gfx.h>
 #include<sokol_log.h>
+#include<sokol_time.h>
 
-// GLFW
+// Sokol Shape - Its Implementation Is Not Warning Clean Under The Debug Flags
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#include<util/sokol_shape.h>
+#pragma GCC diagnostic pop
+
+// GLFW - Not Available in Headless Builds
+#ifndef SGL_HEADLESS
 #define GLFW_INCLUDE_NONE
 #include<GLFW/glfw3.h>
+#endif
 
-// OpenGL Mathematics - GLM
+// OpenGL Mathematics - GLM, SIMD Intrinsics Enabled For Every Translation Unit So Types Match
+#ifndef GLM_FORCE_INTRINSICS
+#define GLM_FORCE_INTRINSICS
+#endif
 #include<glm/glm.hpp>
 #include<glm/gtc/matrix_transform.hpp>
+#include<glm/gtc/quaternion.hpp>
+#include<glm/simd/matrix.h>
 
 // STB Image
 #include<stb_image.h>
 
+// STB Rect Pack
+#include<stb_rect_pack.h>
+
+// Profile The Rest of The Enclosing Scope as a Named Zone
+#define SGL_PROFILE_CONCAT_INNER(a, b) a##b
+#define SGL_PROFILE_CONCAT(a, b) SGL_PROFILE_CONCAT_INNER(a, b)
+#define SGL_PROFILE_SCOPE(profiler, name) sgl::ProfileScope SGL_PROFILE_CONCAT(profileScope, __LINE__)(profiler, name)
+
 namespace sgl {
-    // Texture Class
+    // Forward Declarations
+    class TextureLoader;
+    class Camera;
+    class ShaderReloader;
+
+    // Hash Bytes - 64-Bit FNV-1a, Chain Calls by Passing The Previous Hash as The Seed
+    uint64_t hashBytes(const void* data, const size_t &size, const uint64_t &seed = 14695981039346656037ull);
+
+    // GPU Resource Handle Class - Move-Only Owner of a Sokol Resource, Destroyed When The Handle Goes Out of Scope
+    template<typename T, void (*Destroy)(T)> class Handle {
+        public:
+            // Constructor - Take Ownership of a Sokol Resource
+            Handle(void) = default;
+            explicit Handle(const T &resource) {this->resource = resource;}
+
+            // Destructor - Destroy The Resource (Skipped After sg_shutdown, Which Frees Everything)
+            ~Handle(void) {this->reset();}
+
+            // Handles Cannot Be Copied, Only Moved
+            Handle(const Handle&) = delete;
+            Handle &operator=(const Handle&) = delete;
+            Handle(Handle &&other) noexcept {this->resource = other.release();}
+            Handle &operator=(Handle &&other) noexcept {
+                if(this != &other) {
+                    this->reset();
+                    this->resource = other.release();
+                }
+                return *this;
+            }
+
+            // Destroy The Resource Now
+            void reset(void) {
+                if(this->resource.id != SG_INVALID_ID && sg_isvalid()) Destroy(this->resource);
+                this->resource = {};
+            }
+
+            // Give Up Ownership Without Destroying The Resource
+            T release(void) {
+                const T resource {this->resource};
+                this->resource = {};
+                return resource;
+            }
+
+            // Getters
+            T get(void) const {return this->resource;}
+        private:
+            // Owned Sokol Resource
+            T resource {};
+    };
+    using BufferHandle = Handle<sg_buffer, sg_destroy_buffer>;
+    using ImageHandle = Handle<sg_image, sg_destroy_image>;
+    using SamplerHandle = Handle<sg_sampler, sg_destroy_sampler>;
+    using ShaderHandle = Handle<sg_shader, sg_destroy_shader>;
+    using PipelineHandle = Handle<sg_pipeline, sg_destroy_pipeline>;
+
+    // Resource Cache Keys - Zeroed Then Filled In Field by Field, So Padding Bytes Are Always Zero and The Label Is Left Out
+    void makeCacheKey(const sg_sampler_desc &desc, sg_sampler_desc &key);
+    void makeCacheKey(const sg_pipeline_desc &desc, sg_pipeline_desc &key);
+
+    // Resource Cache Class - Identical Descs Return The Same Resource Instead of Creating a New One
+    // Descs Are Copied Into a Key (makeCacheKey) Whose Bytes Are Hashed and Compared, So Their Padding Never Causes a Miss
+    template<typename Desc, typename T, T (*Make)(const Desc*), void (*Destroy)(T)> class ResourceCache {
+        public:
+            // Get Resource For a Desc - Created on First Use, Owned by The Cache
+            T get(const Desc &desc) {
+                // Hash Desc Without Its Label or Padding
+                Desc key;
+                makeCacheKey(desc, key);
+                const uint64_t hash {hashBytes(&key, sizeof(key))};
+
+                // Look For an Identical Desc Among Resources With The Same Hash
+                std::vector<Entry> &bucket {this->entries[hash]};
+                for(const Entry &entry : bucket) {
+                    if(std::memcmp(&entry.desc, &key, sizeof(key)) == 0) {
+                        this->hits++;
+                        return entry.resource.get();
+                    }
+                }
+
+                // Create Resource
+                this->misses++;
+                bucket.push_back({key, Handle<T, Destroy>(Make(&desc))});
+                return bucket.back().resource.get();
+            }
+
+            // Getters
+            uint64_t getHits(void) const {return this->hits;}
+            uint64_t getMisses(void) const {return this->misses;}
+        private:
+            // Cache Entry
+            struct Entry {
+                Desc desc;
+                Handle<T, Destroy> resource;
+            };
+
+            // Cache Entries Keyed by Desc Hash
+            std::unordered_map<uint64_t, std::vector<Entry>> entries;
+
+            // Cache Statistics
+            uint64_t hits {0}, misses {0};
+    };
+    using SamplerCache = ResourceCache<sg_sampler_desc, sg_sampler, sg_make_sampler, sg_destroy_sampler>;
+    using PipelineCache = ResourceCache<sg_pipeline_desc, sg_pipeline, sg_make_pipeline, sg_destroy_pipeline>;
+
+    // Shader Registry Class - Every Permutation of One Shader, Each Feature Bit Compiled In as a #define Instead of a Uniform Branch
+    // Permutations Are Generated at Build Time (sgl_add_shader_permutations in CMakeLists.txt), Shaders and Pipelines Are Created on First Use
+    class ShaderRegistry {
+        public:
+            // Function sokol-shdc Generates For Each Permutation
+            using ShaderDescFunc = const sg_shader_desc* (*)(sg_backend);
+
+            // Constructor - permutations[Mask] Is The Desc Function For The Permutation With Those Feature Bits Set, featureNames[Bit] The Define Bit Compiles In
+            // With a Shader Reloader, Every Shader and Pipeline Created Is Watched, Recompiled From <shaderName>.glsl With Its Permutation's Defines
+            ShaderRegistry(const std::string &shaderName, const ShaderDescFunc* permutations, const char* const* featureNames, const uint32_t &numPermutations, ShaderReloader* shaderReloader = nullptr);
+
+            // Get Shader For a Permutation - Created on First Use
+            sg_shader getShader(const uint32_t &permutationMask);
+
+            // Get Pipeline For a Permutation - pipelineDesc Holds The Vertex Layout and Render State, Its Shader Is Filled In
+            // Keyed by The Whole Desc, So The Same (Permutation, Layout, Render State) Always Returns The Same Pipeline
+            sg_pipeline getPipeline(const uint32_t &permutationMask, const sg_pipeline_desc &pipelineDesc);
+
+            // Getters
+            uint32_t getPermutationCount(void);
+            uint32_t getShaderCount(void);
+            uint64_t getPipelineHits(void);
+            uint64_t getPipelineMisses(void);
+        private:
+            // Defines For a Permutation - Colon Separated Names of The Features Set in permutationMask, as sokol-shdc's --defines Takes Them
+            std::string getDefines(const uint32_t &permutationMask);
+
+            // Shader Name (Its Source File and Program), Feature Names Indexed by Bit and The Reloader Watching Created Shaders, if Any
+            std::string shaderName;
+            std::vector<std::string> featureNames;
+            ShaderReloader* shaderReloader {nullptr};
+
+            // Desc Functions and Shaders Indexed by Permutation Mask - Shaders Stay Invalid Until First Used
+            std::vector<ShaderDescFunc> permutations;
+            std::vector<ShaderHandle> shaders;
+            uint32_t numShaders {0};
+
+            // Pipelines For Every Permutation - Declared After The Shaders So They're Destroyed First
+            PipelineCache pipelines;
+    };
+
+    // Shader Reloader Class - Dev Mode Shader Hot Reload: Watches Shader Sources With inotify and Recompiles Changed Ones With sokol-shdc on a Background Thread
+    // Watched Shaders and Their Pipelines Are Rebuilt in Place (Handles Stay The Same), The Old Objects Stay When Compiling or Creating Fails
+    // Only Shader Code Reloads - The Compiled-In Desc Supplies Attributes, Uniform Blocks and Images, So Changing Those Still Needs a Rebuild
+    class ShaderReloader {
+        public:
+            // Constructor - Start Watching shaderSrcDirPath, Compiling With The sokol-shdc Binary at shaderCompilerPath
+            ShaderReloader(const std::string &shaderSrcDirPath, const std::string &shaderCompilerPath);
+
+            // Destructor - Stop Watcher Thread
+            ~ShaderReloader(void);
+
+            // Shader Reloaders Cannot Be Copied
+            ShaderReloader(const ShaderReloader&) = delete;
+            ShaderReloader &operator=(const ShaderReloader&) = delete;
+
+            // Watch Shader - Program programName in shaderSrcFileName, shaderDescFunc Is The Function sokol-shdc Generated For It
+            // defines Are The Colon Separated Defines It Was Compiled With (a Shader Permutation), Passed to sokol-shdc as --defines
+            void addShader(const sg_shader &shader, const std::string &shaderSrcFileName, const std::string &programName, const sg_shader_desc* (*shaderDescFunc)(sg_backend), const std::string &defines = "");
+
+            // Watch Pipeline - Rebuilt From pipelineDesc Whenever Its Shader Reloads
+            void addPipeline(const sg_pipeline &pipeline, const sg_pipeline_desc &pipelineDesc);
+
+            // Swap In Recompiled Shaders - Call Once Per Frame Outside Render Passes, Returns The Number of Shaders Reloaded
+            int update(void);
+        private:
+            // Watched Shader and The Program It Was Compiled From
+            struct WatchedShader {
+                sg_shader shader {};
+                std::string shaderSrcFileName, programName, defines;
+                sg_shader_desc shaderDesc {};
+            };
+
+            // Watched Pipeline
+            struct WatchedPipeline {
+                sg_pipeline pipeline {};
+                sg_pipeline_desc pipelineDesc {};
+            };
+
+            // Recompiled Program Waiting to Be Swapped In, and When Its Source Changed
+            struct CompiledProgram {
+                std::string shaderSrcFileName, programName, defines;
+                std::string vsSource, fsSource;
+                std::chrono::steady_clock::time_point changeTime;
+            };
+
+            // Watcher Thread Main Loop
+            void watcherMain(void);
+
+            // Compile a Changed Shader Source File and Queue Its Watched Programs - Once Per Set of Defines Watched Programs Use
+            void compile(const std::string &shaderSrcFileName, const std::chrono::steady_clock::time_point &changeTime);
+
+            // Compile a Shader Source File With One Set of Defines and Queue Its Watched Programs
+            void compile(const std::string &shaderSrcFileName, const std::string &defines, const std::set<std::string> &programNames, const std::chrono::steady_clock::time_point &changeTime);
+
+            // Paths and The sokol-shdc Shader Language For The Current Backend
+            std::filesystem::path shaderSrcDirPath, shaderCompilerPath, outputDirPath;
+            std::string shaderLanguage;
+
+            // Watched Shaders and Pipelines - Shaders Are Shared With The Watcher Thread Under watchedMutex
+            std::vector<WatchedShader> watchedShaders;
+            std::vector<WatchedPipeline> watchedPipelines;
+            std::mutex watchedMutex;
+
+            // Programs Compiled by The Watcher Thread
+            std::vector<CompiledProgram> compiledPrograms;
+            std::mutex compiledMutex;
+
+            // Watcher Thread, inotify Descriptor and Whether The Thread Should Stop
+            std::thread watcher;
+            int inotifyFd {-1};
+            std::atomic<bool> stopping {false};
+    };
+
+    // Mapped File Class - Read-Only Memory Mapping of a Whole File
+    class MappedFile {
+        public:
+            // Constructor - Map File Into Memory
+            MappedFile(const std::string &filePath);
+
+            // Destructor - Unmap File
+            ~MappedFile(void);
+
+            // Mapped Files Cannot Be Copied
+            MappedFile(const MappedFile&) = delete;
+            MappedFile &operator=(const MappedFile&) = delete;
+
+            // Getters
+            bool isOpen(void);
+            const uint8_t* getData(void);
+            size_t getSize(void);
+        private:
+            // Mapped File Data
+            void* data {nullptr};
+            size_t size {0};
+    };
+
+    // Cooked Texture Blob - Header Followed by The Pixel Data of Every Mip Level, Written by textureCooker
+    struct TextureBlobHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t width, height;
+        uint32_t pixelFormat;
+        uint32_t numMipmaps;
+        uint64_t mipOffsets[SG_MAX_MIPMAPS];
+        uint64_t mipSizes[SG_MAX_MIPMAPS];
+    };
+    inline constexpr char textureBlobMagic[4] {'S', 'G', 'L', 'T'};
+    inline constexpr uint32_t textureBlobVersion {1};
+    inline constexpr const char* textureBlobExtension {".sgltex"};
+    inline constexpr uint32_t textureBlobMaxSize {16384};
+
+    // Point Image Desc at a Mapped Texture Blob's Mip Levels - No Copy or Decode, Returns False if The Blob Is Invalid
+    // Block Compressed Blobs Are Decompressed to RGBA8 Into fallbackData Instead When decompressBlockFormats Is Set
+    bool loadTextureBlob(MappedFile &texBlob, sg_image_desc &imgDesc, std::vector<uint8_t> &fallbackData, const bool &decompressBlockFormats);
+
+    // Check if a Texture Image File Path Refers to a Cooked Texture Blob
+    bool isTextureBlob(const std::string &texImgFilePath);
+
+    // Block Compressed (BC1/BC3) Texture Images
+    bool isBlockCompressedFormat(const sg_pixel_format &pixelFormat);
+    bool canSampleBlockFormats(void);
+    size_t getBlockCompressedSize(const sg_pixel_format &pixelFormat, const int &width, const int &height);
+    void decompressBlockImage(const uint8_t* blocks, const sg_pixel_format &pixelFormat, const int &width, const int &height, uint8_t* rgba);
+
+    // Texture Class - Owns Its Image, Move-Only
     class Texture {
         public:
             // Constructor - Load Texture Image File and Create Texture Object
             Texture(sg_image_desc &imgDesc, const std::string &texImgFilePath);
 
+            // Constructor - Queue Texture Image File on a Texture Loader and Use Its Placeholder Until Loaded
+            Texture(TextureLoader &texLoader, const sg_image_desc &imgDesc, const std::string &texImgFilePath);
+
             // Getters
             sg_image getImage(void);
         private:
             // Texture Object
-            sg_image texture;
+            ImageHandle texture;
+    };
+
+    // Estimated GPU Memory Used by an Image - Every Mip Level of Every Face/Layer
+    size_t getImageByteSize(const sg_image_desc &imgDesc);
+
+    // Texture Cache Class - Ref-Counted Textures Keyed by File Path, Least Recently Used Unreferenced Textures Are Evicted Over Budget
+    class TextureCache {
+        public:
+            // Cache Statistics
+            struct Stats {
+                uint64_t hits {0}, misses {0}, evictions {0}, failures {0};
+                size_t residentBytes {0}, residentCount {0};
+            };
+
+            // Constructor - Image Desc Used For Every Texture and Resident Memory Budget in Bytes
+            TextureCache(const sg_image_desc &imgDesc, const size_t &budgetBytes);
+
+            // Acquire Texture - Loads It on a Miss (Reloading Evicted Textures), Stays Resident Until Released
+            sg_image acquire(const std::string &texImgFilePath);
+
+            // Release Texture - Unreferenced Textures Stay Resident Until Evicted
+            void release(const std::string &texImgFilePath);
+
+            // Evict Least Recently Used Unreferenced Textures Until Resident Memory Fits The Budget
+            void trim(void);
+
+            // Setters
+            void setBudget(const size_t &budgetBytes);
+
+            // Getters
+            const Stats &getStats(void);
+        private:
+            // Cache Entry
+            struct Entry {
+                Texture texture;
+                size_t byteSize;
+                int refCount;
+                std::list<std::string>::iterator lruPosition;
+            };
+
+            // Cache Entries and Their Use Order - Most Recently Used First
+            std::unordered_map<std::string, Entry> entries;
+            std::list<std::string> lruOrder;
+
+            // Image Desc Used For Every Texture
+            sg_image_desc imgDesc;
+
+            // Resident Memory Budget in Bytes
+            size_t budgetBytes;
+
+            // Cache Statistics
+            Stats stats;
+    };
+
+    // Texture Atlas Class - Packs Many Small Texture Images Into a Few Large Atlas Pages
+    class TextureAtlas {
+        public:
+            // Atlas Sprite - Atlas Page and UV Rect Within It
+            struct Sprite {
+                int page {-1};
+                glm::vec2 uvMin {0.0f}, uvMax {0.0f};
+            };
+
+            // Constructor - Set Atlas Page Size and Padding Around Each Sprite (Filled by Extruding Its Edges)
+            TextureAtlas(const int &pageSize, const int &padding);
+
+            // Add Texture Image File or RGBA8 Pixels - Returns The Sprite Index
+            int addImage(const std::string &texImgFilePath);
+            int addPixels(const uint8_t* pixels, const int &width, const int &height);
+
+            // Pack Every Added Image Into Atlas Pages and Create a Texture Image Per Page
+            void build(const sg_image_desc &imgDesc);
+
+            // Rewrite Sprite Space [0, 1] Texture Coordinates of Interleaved Float Vertices to Atlas Space
+            void remapTexCoords(const int &spriteIndex, float* vertices, const size_t &numVertices, const size_t &stride, const size_t &texCoordOffset);
+
+            // Getters
+            const Sprite &getSprite(const int &spriteIndex);
+            sg_image getPageImage(const int &page);
+            int getPageCount(void);
+        private:
+            // Source Image Pixels - Kept Until The Atlas Is Built
+            struct SourceImage {
+                std::vector<uint8_t> pixels;
+                int width, height;
+            };
+            std::vector<SourceImage> sourceImages;
+
+            // Sprites and Atlas Page Images
+            std::vector<Sprite> sprites;
+            std::vector<ImageHandle> pages;
+
+            // Atlas Page Size and Padding Around Each Sprite
+            int pageSize, padding;
+    };
+
+    // Job Counter Class - Counts Unfinished Jobs Run Against It, Waited on With JobSystem::wait or Used as a Job Dependency
+    // Call JobSystem::wait Before Destroying a Counter That Jobs Were Run Against
+    class JobCounter {
+        public:
+            // All Jobs Counted Against It Have Finished
+            bool isDone(void) {return this->count.load(std::memory_order_acquire) == 0;}
+        private:
+            friend class JobSystem;
+
+            // Unfinished Jobs
+            std::atomic<int> count {0};
+
+            // Jobs Waiting For The Count to Reach Zero and The Counters They Finish Against
+            std::mutex continuationsMutex;
+            std::vector<std::pair<std::function<void(void)>, JobCounter*>> continuations;
+    };
+
+    // Job System Class - Work-Stealing Thread Pool, Each Thread Pops Its Own Deque's Newest Job and Steals Other Deques' Oldest
+    class JobSystem {
+        public:
+            // Constructor - numThreads Threads Run Jobs, Including The Thread Calling wait (So numThreads - 1 Workers Are Started)
+            JobSystem(const unsigned int &numThreads);
+
+            // Destructor - Finish Queued Jobs and Join Worker Threads
+            ~JobSystem(void);
+
+            // Job Systems Cannot Be Copied
+            JobSystem(const JobSystem&) = delete;
+            JobSystem &operator=(const JobSystem&) = delete;
+
+            // Run Job - Counted Against counter Until It Finishes When One Is Given
+            void run(std::function<void(void)> job, JobCounter* counter = nullptr);
+
+            // Run Job Once Every Job Counted Against dependency Has Finished
+            void runAfter(JobCounter &dependency, std::function<void(void)> job, JobCounter* counter = nullptr);
+
+            // Wait For Every Job Counted Against counter - The Waiting Thread Runs Queued Jobs Meanwhile
+            void wait(JobCounter &counter);
+
+            // Parallel For - Calls func(begin, end) Over [0, count) Split Into Ranges of grainSize, Returns When All Are Done
+            template<typename Func> void parallelFor(const size_t &count, const size_t &grainSize, const Func &func) {
+                JobCounter counter;
+                const size_t rangeSize {std::max(grainSize, static_cast<size_t>(1))};
+                for(size_t begin {0}; begin < count; begin += rangeSize) {
+                    const size_t end {std::min(begin + rangeSize, count)};
+                    this->run([&func, begin, end](void) {func(begin, end);}, &counter);
+                }
+                this->wait(counter);
+            }
+
+            // Getters
+            unsigned int getThreadCount(void);
+        private:
+            // Queued Job and The Counter It Finishes Against
+            struct Job {
+                std::function<void(void)> func;
+                JobCounter* counter;
+            };
+
+            // Per-Thread Job Deque - Index 0 Belongs to Threads That Are Not Workers
+            struct Queue {
+                std::mutex mutex;
+                std::deque<Job> jobs;
+            };
+
+            // Worker Thread Main Loop
+            void workerMain(const unsigned int &queueIndex);
+
+            // Queue a Job on The Calling Thread's Deque and Wake a Worker
+            void push(Job job);
+
+            // Pop a Job From The Calling Thread's Deque or Steal One - False if Every Deque Is Empty
+            bool tryGetJob(Job &job);
+
+            // Run a Job and Finish It Against Its Counter, Queueing Jobs That Were Waiting on The Counter
+            void execute(Job &job);
+
+            // Calling Thread's Deque Index
+            unsigned int getQueueIndex(void);
+
+            // Job Deques and Worker Threads
+            std::vector<std::unique_ptr<Queue>> queues;
+            std::vector<std::thread> workers;
+
+            // Queued Jobs - Workers Sleep While It Is Zero
+            std::atomic<int> queuedJobs {0};
+            std::mutex sleepMutex;
+            std::condition_variable sleepCondition;
+            bool stopping {false};
+    };
+
+    // Texture Loader Class - Decodes Texture Image Files on Worker Threads, Uploads Them on The Render Thread
+    class TextureLoader {
+        public:
+            // Constructor - Start Worker Threads
+            TextureLoader(const unsigned int &numThreads, const size_t &uploadBudget);
+
+            // Destructor - Stop Worker Threads and Free Any Decoded Image Data Not Yet Uploaded
+            ~TextureLoader(void);
+
+            // Queue Texture Image File For Decoding - Returns an Image Holding a Placeholder Until Uploaded
+            sg_image load(const sg_image_desc &imgDesc, const std::string &texImgFilePath);
+
+            // Upload Decoded Texture Images - Call Once Per Frame, Uploads At Most uploadBudget Bytes (At Least One Image)
+            void update(void);
+
+            // Block Until Every Queued Texture Image Has Been Decoded and Uploaded
+            void finish(void);
+
+            // Getters
+            size_t getPendingCount(void);
+        private:
+            // Texture Load Job
+            struct Job {
+                sg_image image {};
+                sg_image_desc imgDesc {};
+                std::string texImgFilePath;
+                stbi_uc* texImg {nullptr};
+                int texWidth {0}, texHeight {0};
+                std::unique_ptr<MappedFile> texBlob;
+                std::vector<uint8_t> texBlobFallback;
+                bool texBlobLoaded {false}, decompressBlockFormats {false};
+            };
+
+            // Worker Thread Main Loop
+            void workerMain(void);
+
+            // Worker Threads
+            std::vector<std::thread> workers;
+
+            // Jobs Waiting to Be Decoded and Jobs Waiting to Be Uploaded
+            std::deque<Job> decodeQueue, uploadQueue;
+            std::mutex queueMutex;
+            std::condition_variable decodeCondition, uploadCondition;
+
+            // Number of Jobs Not Yet Uploaded
+            size_t pendingCount {0};
+
+            // Maximum Number of Bytes Uploaded Per Frame
+            size_t uploadBudget;
+
+            // Worker Threads Should Stop
+            bool stopping {false};
+    };
+
+    // Transform Store Class - Structure-of-Arrays Position/Rotation/Scale With Dirty Flags and Parents, World Matrices Updated in Batches
+    class TransformStore {
+        public:
+            // Add Transform - The Parent Must Already Be Added (-1 For None), Returns The Transform's Index
+            uint32_t add(const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale, const int &parent = -1);
+
+            // Setters - Mark The Transform (And Through update, Its Descendants) Dirty, Safe From Jobs Setting Different Transforms
+            void setPosition(const uint32_t &index, const glm::vec3 &position);
+            void setRotation(const uint32_t &index, const glm::quat &rotation);
+            void setScale(const uint32_t &index, const glm::vec3 &scale);
+
+            // Update World Matrices of Dirty Transforms - Local Matrices Are Built in Parallel When a Job System Is Given
+            void update(JobSystem* jobSystem = nullptr);
+
+            // Multiply One Matrix by a Batch (out[i] = lhs * rhs[i]) With SSE When Available - Apply a Shared View-Projection Once Per Frame
+            static void multiply(const glm::mat4 &lhs, const glm::mat4* rhs, glm::mat4* out, const size_t &count);
+
+            // Build a Local Matrix From Position, Rotation and Scale (Translate * Rotate * Scale)
+            static glm::mat4 makeLocalMatrix(const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale);
+
+            // Getters
+            const glm::mat4 &getWorldMatrix(const uint32_t &index);
+            const glm::mat4* getWorldMatrices(void);
+            glm::vec3 getPosition(const uint32_t &index);
+            glm::quat getRotation(const uint32_t &index);
+            glm::vec3 getScale(const uint32_t &index);
+            int getParent(const uint32_t &index);
+            size_t getCount(void);
+        private:
+            // Dirty Flags - Local TRS Changed / World Matrix Needs Recomposing
+            static constexpr uint8_t localDirty {1}, worldDirty {2};
+
+            // Components
+            std::vector<glm::vec3> positions;
+            std::vector<glm::quat> rotations;
+            std::vector<glm::vec3> scales;
+            std::vector<int> parents;
+            std::vector<uint8_t> dirtyFlags;
+
+            // Local and World Matrices
+            std::vector<glm::mat4> localMatrices, worldMatrices;
+
+            // Transforms With a Parent, in Index Order (Parents Before Children)
+            std::vector<uint32_t> childIndices;
+    };
+
+    // Axis-Aligned Bounding Box
+    struct AABB {
+        glm::vec3 min {0.0f}, max {0.0f};
+
+        // Bounds of This Box After a Transform
+        AABB transform(const glm::mat4 &matrix) const;
+
+        // Grow to Contain Another Box
+        void merge(const AABB &other);
+
+        // Getters
+        glm::vec3 getCenter(void) const;
+        glm::vec3 getExtents(void) const;
+    };
+
+    // Bounding Spheres in Structure-of-Arrays Form For Batched Frustum Tests
+    struct SphereArray {
+        std::vector<float> centerX, centerY, centerZ, radii;
+
+        // Add / Replace Sphere
+        void add(const glm::vec3 &center, const float &radius);
+        void set(const size_t &index, const glm::vec3 &center, const float &radius);
+
+        // Remove Every Sphere
+        void clear(void);
+
+        // Getters
+        size_t getCount(void) const;
+    };
+
+    // Axis-Aligned Bounding Boxes as Centers and Extents in Structure-of-Arrays Form For Batched Frustum Tests
+    struct AABBArray {
+        std::vector<float> centerX, centerY, centerZ, extentX, extentY, extentZ;
+
+        // Add / Replace Box
+        void add(const AABB &aabb);
+        void set(const size_t &index, const AABB &aabb);
+
+        // Remove Every Box
+        void clear(void);
+
+        // Getters
+        size_t getCount(void) const;
+    };
+
+    // Frustum Class - Six Planes Extracted From a Projection * View Matrix, Normals Point Inwards
+    class Frustum {
+        public:
+            // Constructor - Extract and Normalize Planes (Left, Right, Bottom, Top, Near, Far)
+            Frustum(const glm::mat4 &viewProjMatrix);
+
+            // Single Tests - True When Inside or Intersecting
+            bool intersects(const glm::vec3 &center, const float &radius) const;
+            bool intersects(const AABB &aabb) const;
+
+            // Batched Tests - visible[i] Is 1 When Inside or Intersecting, 0 When Outside, Returns The Visible Count
+            // Eight (AVX) or Four (SSE) Objects Per Step, Split Over a Job System When One Is Given
+            size_t cull(const SphereArray &spheres, std::vector<uint8_t> &visible, JobSystem* jobSystem = nullptr) const;
+            size_t cull(const AABBArray &aabbs, std::vector<uint8_t> &visible, JobSystem* jobSystem = nullptr) const;
+
+            // Getters
+            const glm::vec4 &getPlane(const int &index) const;
+        private:
+            // Cull a Range of Objects - Returns The Visible Count in The Range
+            size_t cullSpheres(const SphereArray &spheres, uint8_t* visible, const size_t &begin, const size_t &end) const;
+            size_t cullAABBs(const AABBArray &aabbs, uint8_t* visible, const size_t &begin, const size_t &end) const;
+
+            // Planes - xyz Normal, w Distance
+            glm::vec4 planes[6];
+    };
+
+    // Scene Graph Class - Node Hierarchy in Flat Arrays in Depth-First Order, So Every Subtree Is a Contiguous Index Range
+    // Only Dirty Subtrees Are Recomputed, Each Node Caches Its World Matrix, World Bounds and The Bounds of Its Whole Subtree
+    class SceneGraph {
+        public:
+            // Node ID - Stable Across Inserts and Removals, Unlike Array Indices
+            using NodeId = uint32_t;
+            static constexpr NodeId invalidNode {UINT32_MAX};
+
+            // Add Node as The Last Child of parent (invalidNode For a Root) - Later Nodes Shift, So Build Parents First
+            NodeId addNode(const NodeId &parent, const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale, const AABB &localBounds);
+
+            // Remove Node and Its Whole Subtree
+            void removeNode(const NodeId &node);
+
+            // Setters - Mark The Node's Subtree Dirty
+            void setPosition(const NodeId &node, const glm::vec3 &position);
+            void setRotation(const NodeId &node, const glm::quat &rotation);
+            void setScale(const NodeId &node, const glm::vec3 &scale);
+            void setLocalBounds(const NodeId &node, const AABB &localBounds);
+
+            // Recompute World Matrices and Bounds of Dirty Subtrees and Subtree Bounds of Their Ancestors - Returns Nodes Recomputed
+            size_t update(void);
+
+            // Getters - By Node ID
+            const glm::mat4 &getWorldMatrix(const NodeId &node);
+            const AABB &getWorldBounds(const NodeId &node);
+            const AABB &getSubtreeBounds(const NodeId &node);
+            glm::vec3 getPosition(const NodeId &node);
+            glm::quat getRotation(const NodeId &node);
+            glm::vec3 getScale(const NodeId &node);
+            NodeId getParent(const NodeId &node);
+
+            // Getters - Flat Arrays in Depth-First Order For Culling, The Subtree of Index i Is [i, getSubtreeEnd(i))
+            size_t getNodeCount(void);
+            uint32_t getIndex(const NodeId &node);
+            NodeId getNodeId(const uint32_t &index);
+            uint32_t getSubtreeEnd(const uint32_t &index);
+            const glm::mat4* getWorldMatrices(void);
+            const AABB* getWorldBoundsArray(void);
+            const AABB* getSubtreeBoundsArray(void);
+        private:
+            // Insert / Erase Slots in Every Per-Node Array
+            void insertSlot(const uint32_t &index);
+            void eraseSlots(const uint32_t &first, const uint32_t &count);
+
+            // Recompute a Node's Subtree Bounds From Its World Bounds and Its Children's Subtree Bounds
+            void updateSubtreeBounds(const uint32_t &index);
+
+            // Mark a Node's Subtree Dirty
+            void markDirty(const NodeId &node);
+
+            // Per-Node Arrays in Depth-First Order - Parent Index (-1 For Roots) and One Past The Last Index of The Subtree
+            std::vector<int> parents;
+            std::vector<uint32_t> subtreeEnds;
+            std::vector<NodeId> nodeIds;
+            std::vector<glm::vec3> positions;
+            std::vector<glm::quat> rotations;
+            std::vector<glm::vec3> scales;
+            std::vector<glm::mat4> worldMatrices;
+            std::vector<AABB> localBounds, worldBounds, subtreeBounds;
+            std::vector<uint8_t> dirtyFlags;
+
+            // Node ID to Index (UINT32_MAX For Free IDs) and Free IDs
+            std::vector<uint32_t> nodeIndices;
+            std::vector<NodeId> freeNodeIds;
+
+            // Nodes Marked Dirty Since The Last Update
+            std::vector<NodeId> dirtyNodes;
+    };
+
+    // Bounding Volume Hierarchy Class - Dynamic AABB Tree With One Proxy Per Leaf, Nodes in One Flat Array
+    // build Makes a Binned SAH Tree in Depth-First Order, insert/remove Patch It Incrementally and refit Recomputes Bounds Bottom-Up
+    class BVH {
+        public:
+            // Proxy ID - Handle to One Object's Bounds, Stable Until Removed
+            using ProxyId = uint32_t;
+            static constexpr ProxyId invalidProxy {UINT32_MAX};
+
+            // Ray Cast Result - Nearest Proxy Whose Bounds The Ray Hits and The Distance Along The Ray (0 When The Origin Is Inside)
+            struct RayHit {
+                ProxyId proxy {invalidProxy};
+                float distance {0.0f};
+            };
+
+            // Build From Scratch - Proxy i Gets bounds[i], Large Subtrees Are Built as Jobs When a Job System Is Given
+            void build(const std::vector<AABB> &bounds, JobSystem* jobSystem = nullptr);
+
+            // Rebuild From The Current Proxies' Bounds Keeping Their IDs - Restores Tree Quality After Many Inserts or Large Moves
+            void rebuild(JobSystem* jobSystem = nullptr);
+
+            // Insert Proxy - Descends Towards The Sibling That Grows The Tree's Surface Area Least
+            ProxyId insert(const AABB &bounds);
+
+            // Remove Proxy
+            void remove(const ProxyId &proxy);
+
+            // Set a Proxy's Bounds - Ancestors Are Fixed by The Next refit, Safe to Call From Several Threads For Different Proxies
+            void setBounds(const ProxyId &proxy, const AABB &bounds);
+
+            // Set a Proxy's Bounds and Refit Its Ancestors Right Away - For a Few Moving Objects Among Many Static Ones
+            void updateBounds(const ProxyId &proxy, const AABB &bounds);
+
+            // Recompute Every Internal Node's Bounds From Its Children, Children Before Parents
+            void refit(void);
+
+            // Queries - Append Proxies Whose Bounds Intersect, Return The Number Appended
+            size_t query(const Frustum &frustum, std::vector<ProxyId> &results) const;
+            size_t query(const AABB &aabb, std::vector<ProxyId> &results) const;
+
+            // Ray Cast - Nearest Proxy Whose Bounds The Ray Hits Within maxDistance, False if None
+            bool raycast(const glm::vec3 &origin, const glm::vec3 &direction, const float &maxDistance, RayHit &hit) const;
+
+            // Getters
+            const AABB &getBounds(const ProxyId &proxy) const;
+            size_t getProxyCount(void) const;
+            size_t getNodeCount(void) const;
+
+            // Surface Area Heuristic Cost - Internal Nodes' Surface Area Relative to The Root's, Lower Is a Better Tree
+            float getCost(void) const;
+        private:
+            static constexpr uint32_t invalidNode {UINT32_MAX};
+
+            // Node - 32 Bytes, Two Per Cache Line. Leaves Have left == invalidNode and Store Their Proxy in right
+            struct Node {
+                AABB bounds;
+                uint32_t left {invalidNode}, right {invalidNode};
+            };
+
+            // Proxy Being Built - Partitioned in Place While Splitting
+            struct BuildProxy {
+                AABB bounds;
+                glm::vec3 centroid;
+                ProxyId proxy;
+            };
+
+            // Replace The Tree With One Built Over proxies
+            void buildFrom(std::vector<BuildProxy> &proxies, JobSystem* jobSystem);
+
+            // Build The Subtree of proxies[begin, end) at nodeIndex - Subtrees of n Proxies Take 2n - 1 Nodes, Left Child First
+            void buildNodes(BuildProxy* proxies, const uint32_t &begin, const uint32_t &end, const uint32_t &nodeIndex, const uint32_t &parent, JobSystem* jobSystem, JobCounter* counter);
+
+            // Allocate / Free a Node
+            uint32_t allocNode(void);
+            void freeNode(const uint32_t &node);
+
+            // Recompute Bounds From node Up to The Root, Stopping Once an Ancestor's Bounds Don't Change
+            void refitAncestors(uint32_t node);
+
+            // Append Every Proxy in a Subtree
+            void appendSubtree(const uint32_t &node, std::vector<ProxyId> &results) const;
+
+            // Nodes, Their Parents (invalidNode For The Root) and Free Node Slots
+            std::vector<Node> nodes;
+            std::vector<uint32_t> parents;
+            std::vector<uint32_t> freeNodes;
+            uint32_t root {invalidNode};
+
+            // Proxy ID to Leaf Node (invalidNode For Free IDs) and Free IDs
+            std::vector<uint32_t> proxyNodes;
+            std::vector<ProxyId> freeProxies;
+
+            // Internal Nodes With Children Before Parents, Recomputed by refit After Inserts and Removals
+            std::vector<uint32_t> refitOrder;
+            bool refitOrderDirty {true};
+    };
+
+    // Mesh Submesh - Range of Indices Drawn on Its Own, Like One OBJ Material Group
+    struct MeshSubmesh {
+        uint32_t firstIndex {0}, numIndices {0};
+    };
+
+    // Mesh Data - CPU-Side Indexed Triangle List, normals/texCoords Are Empty When The Mesh Has None
+    // No Submeshes Means One Covering Every Index
+    struct MeshData {
+        std::vector<glm::vec3> positions, normals;
+        std::vector<glm::vec2> texCoords;
+        std::vector<uint32_t> indices;
+        std::vector<MeshSubmesh> submeshes;
+
+        // Getters
+        size_t getVertexCount(void) const;
+        size_t getTriangleCount(void) const;
+        AABB getBounds(void) const;
+    };
+
+    // Simplify Mesh - Quadric Error Metric Edge Collapse Until targetTriangles Remain or The Next Collapse Would Exceed maxError
+    // Vertices on UV/Normal Seams and Submesh Boundaries Stay Put, Border Vertices Only Slide Along The Border - Returns The Object-Space Error Reached
+    float simplifyMesh(const MeshData &mesh, const size_t &targetTriangles, const float &maxError, MeshData &simplified);
+
+    // Mesh LOD - Simplified Mesh and Its Object-Space Error Against The Source Mesh
+    struct MeshLOD {
+        MeshData mesh;
+        float error {0.0f};
+    };
+
+    // Build LOD Chain - Level 0 Is The Source, Each Level Keeps About triangleRatio of The Previous Level's Triangles
+    // Stops Early Once Simplification Stalls (Seams and Borders Left Nothing to Collapse)
+    std::vector<MeshLOD> buildLODChain(const MeshData &mesh, const int &maxLevels, const float &triangleRatio = 0.5f);
+
+    // LOD Selector Class - Picks a Level Per Object From The Projected Size of Its Bounding Sphere, With Hysteresis Against Popping
+    class LODSelector {
+        public:
+            // Constructor - screenSizes[i] Is The Screen Size Below Which Level i + 1 Replaces Level i (Descending)
+            // A Switch Only Happens Once The Size Is hysteresis (a Fraction of The Threshold) Past It
+            LODSelector(const std::vector<float> &screenSizes, const float &hysteresis = 0.1f);
+
+            // Screen Sizes For an LOD Chain - Each Level Is Used While Its Error Projects to Less Than maxScreenError (Fraction of Viewport Height)
+            static std::vector<float> makeScreenSizes(const std::vector<MeshLOD> &chain, const float &maxScreenError);
+
+            // Screen Size - Bounding Sphere's Projected Diameter as a Fraction of Viewport Height, Using The Camera's Position and FOV
+            static float getScreenSize(Camera &camera, const glm::vec3 &center, const float &radius);
+
+            // Select Level For One Object From Its Screen Size and Current Level
+            int select(const float &screenSize, const int &currentLevel) const;
+
+            // Select Levels For Many Objects - levels Holds Each Object's Current Level and Is Updated in Place (New Objects Start at 0)
+            // Split Over a Job System When One Is Given, Returns The Number of Objects That Changed Level
+            size_t select(Camera &camera, const SphereArray &spheres, std::vector<uint8_t> &levels, JobSystem* jobSystem = nullptr) const;
+
+            // Getters
+            int getLevelCount(void) const;
+        private:
+            // Screen Size Thresholds Between Levels and Hysteresis Fraction
+            std::vector<float> screenSizes;
+            float hysteresis;
+    };
+
+    // Mesh Optimisation - Run After Import, in This Order, Before a Mesh Is Cooked
+    // Vertex Cache - Forsyth's Linear-Speed Reordering of Each Submesh's Triangles So Shared Vertices Stay in The Post-Transform Cache
+    void optimizeVertexCache(MeshData &mesh);
+
+    // Overdraw - Split Each Submesh's Cache-Ordered Triangles Into Clusters, Outward-Facing Clusters First
+    // A Cluster's Cache Miss Ratio May Grow to threshold Times That of The Cache-Ordered Triangles
+    void optimizeOverdraw(MeshData &mesh, const float &threshold = 1.05f);
+
+    // Vertex Fetch - Merge Identical Vertices, Drop Unused Ones and Store Vertices in The Order The Indices First Use Them
+    void optimizeVertexFetch(MeshData &mesh);
+
+    // Average Cache Miss Ratio - Post-Transform Cache Misses Per Triangle For a FIFO Cache of cacheSize Vertices (0.5 Is Ideal, 3 Is Worst)
+    float getACMR(const MeshData &mesh, const int &cacheSize = 16);
+
+    // Load Wavefront OBJ File - Polygons Are Triangulated, Each usemtl Starts a Submesh and Identical v/vt/vn Corners Share a Vertex
+    bool loadOBJ(const std::string &objFilePath, MeshData &mesh);
+
+    // Cooked Mesh Blob - Header, Submesh Table, Interleaved Vertex Data Then Index Data, Written by meshCooker
+    // Attributes Have Fixed Slots in The Header, Unused Ones Have Format SG_VERTEXFORMAT_INVALID
+    inline constexpr int meshAttrPosition {0}, meshAttrNormal {1}, meshAttrTexCoord {2}, meshAttrCount {3};
+    struct MeshBlobAttribute {
+        uint32_t format;
+        uint32_t offset;
+    };
+    struct MeshBlobSubmesh {
+        uint32_t firstIndex, numIndices;
+        float boundsMin[3], boundsMax[3];
+    };
+    struct MeshBlobHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t numVertices, vertexStride;
+        uint32_t numIndices, indexType;
+        uint32_t numSubmeshes;
+        MeshBlobAttribute attributes[meshAttrCount];
+        float boundsMin[3], boundsMax[3];
+        uint64_t submeshOffset, vertexOffset, indexOffset;
+    };
+    inline constexpr char meshBlobMagic[4] {'S', 'G', 'L', 'M'};
+    inline constexpr uint32_t meshBlobVersion {1};
+    inline constexpr const char* meshBlobExtension {".sglmesh"};
+
+    // Write Mesh Blob - Position, Normal and TexCoord (When Present) Interleaved, 16-Bit Indices When Every Vertex Fits
+    // Floats Unless quantize Is Set - Then SHORT4N Positions Within The Bounds, BYTE4N Normals and USHORT2N TexCoords When They Lie in [0, 1]
+    // False Without Writing if The Mesh Is Empty or an Index or Submesh Is Out of Range
+    bool writeMeshBlob(const MeshData &mesh, const std::string &meshBlobFilePath, const bool &quantize = false);
+
+    // Validate a Mapped Mesh Blob and Copy Its Header - False if The Blob Is Invalid
+    bool readMeshBlobHeader(MappedFile &meshBlob, MeshBlobHeader &header);
+
+    // Mesh Class - Vertex and Index Buffers Made Straight From a Memory-Mapped Mesh Blob, Move-Only
+    class Mesh {
+        public:
+            // Submesh - Index Range and Its Bounds
+            struct Submesh {
+                int firstIndex, numIndices;
+                AABB bounds;
+            };
+
+            // Constructor - Map Mesh Blob File and Hand The Mapped Vertex/Index Data to sg_make_buffer, No Copies
+            Mesh(const std::string &meshBlobFilePath);
+
+            // Set a Pipeline's Vertex Layout For This Mesh in bufferIndex and Its Index Type - Attribute Slots of -1 Are Skipped
+            // Offsets and Stride Are Explicit, So Other Buffers in The Pipeline Need Explicit Offsets Too
+            void setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &positionAttr, const int &normalAttr, const int &texCoordAttr) const;
+
+            // Getters
+            bool isLoaded(void) const;
+            sg_buffer getVertexBuffer(void) const;
+            sg_buffer getIndexBuffer(void) const;
+            int getNumVertices(void) const;
+            int getNumIndices(void) const;
+            const AABB &getBounds(void) const;
+            const std::vector<Submesh> &getSubmeshes(void) const;
+
+            // Model Matrix Applied Before The Mesh's Own - Maps Quantized Positions Back Into The Bounds, Identity For Float Positions
+            glm::mat4 getPositionTransform(void) const;
+        private:
+            // Vertex and Index Buffers
+            BufferHandle vertexBuffer, indexBuffer;
+
+            // Blob Header - Vertex Layout, Counts and Index Type
+            MeshBlobHeader header {};
+
+            // Whole Mesh and Submesh Bounds
+            AABB bounds;
+            std::vector<Submesh> submeshes;
+    };
+
+    // Instance Buffer Class - Per-Instance Model Matrices Streamed Into a Vertex Buffer, Drawn With One sg_draw
+    class InstanceBuffer {
+        public:
+            // Constructor - Create Stream Vertex Buffer Holding Up to maxInstances Model Matrices
+            InstanceBuffer(const int &maxInstances);
+
+            // Add Instance For This Frame - Returns False When The Buffer Is Full
+            bool add(const glm::mat4 &modelMatrix);
+
+            // Upload Instances Added This Frame - Once Per Frame (Sokol Allows One Update Per Buffer Per Frame), Then Add The Next Frame's
+            void upload(void);
+
+            // Set Up a Pipeline Desc to Read Model Matrix Columns From This Buffer - Four FLOAT4 Attributes Starting at firstAttr
+            static void setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &firstAttr);
+
+            // Getters
+            sg_buffer getBuffer(void);
+            int getInstanceCount(void);
+        private:
+            // Stream Vertex Buffer and The Model Matrices Waiting to Be Uploaded
+            BufferHandle buffer;
+            std::vector<glm::mat4> modelMatrices;
+
+            // Maximum and Uploaded Number of Instances
+            int maxInstances, instanceCount {0};
+    };
+
+    // Shape Cache Class - Procedural Shapes From sokol_shape Packed Into One Shared Vertex and Index Buffer
+    // Shapes Are Cached by a Hash of Their Parameters, Every Shape Draws From The Same sg_bindings With Its Own Element Range
+    class ShapeCache {
+        public:
+            // Constructor - Create Dynamic Vertex and Index Buffers Holding Up to maxVertices (At Most 65536, Indices Are 16-Bit) and maxIndices
+            ShapeCache(const int &maxVertices, const int &maxIndices);
+
+            // Get Shape's Element Range - Generated on First Request, No Elements When The Cache Is Full
+            sshape_element_range_t getPlane(const float &width, const float &depth, const uint16_t &tiles = 1);
+            sshape_element_range_t getBox(const float &width, const float &height, const float &depth, const uint16_t &tiles = 1);
+            sshape_element_range_t getSphere(const float &radius, const uint16_t &slices, const uint16_t &stacks);
+            sshape_element_range_t getCylinder(const float &radius, const float &height, const uint16_t &slices, const uint16_t &stacks = 1);
+            sshape_element_range_t getTorus(const float &radius, const float &ringRadius, const uint16_t &sides, const uint16_t &rings);
+
+            // Upload Shapes Generated Since The Last Upload - At Most Once Per Frame (Sokol Allows One Update Per Buffer Per Frame), Before Drawing Them
+            void upload(void);
+
+            // Set Up a Pipeline Desc For Shape Vertices in bufferIndex and 16-Bit Indices - Attribute Slots of -1 Are Skipped
+            static void setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &positionAttr, const int &normalAttr, const int &texCoordAttr, const int &colorAttr);
+
+            // Getters
+            sg_buffer getVertexBuffer(void);
+            sg_buffer getIndexBuffer(void);
+            size_t getShapeCount(void);
+            int getVertexCount(void);
+            int getIndexCount(void);
+        private:
+            // Shape Parameters - Kind, Up to Three Sizes and Two Subdivision Counts, Unused Ones Zero
+            struct ShapeKey {
+                uint32_t kind {0};
+                float sizes[3] {0.0f, 0.0f, 0.0f};
+                uint16_t divisions[2] {0, 0};
+                bool operator==(const ShapeKey &other) const;
+            };
+            struct ShapeKeyHash {
+                size_t operator()(const ShapeKey &key) const;
+            };
+
+            // Add Shape - Return The Cached Range For key, Otherwise Build It Into The Shared Vertex and Index Data
+            sshape_element_range_t addShape(const ShapeKey &key, const sshape_sizes_t &sizes, const std::function<sshape_buffer_t(const sshape_buffer_t&)> &buildShape);
+
+            // Dynamic Buffers and The Vertex/Index Data They Hold
+            BufferHandle vertexBuffer, indexBuffer;
+            std::vector<sshape_vertex_t> vertices;
+            std::vector<uint16_t> indices;
+            size_t vertexCount {0}, indexCount {0};
+            bool dirty {false};
+
+            // Element Range of Every Shape Built So Far
+            std::unordered_map<ShapeKey, sshape_element_range_t, ShapeKeyHash> shapes;
+    };
+
+    // Transient Allocation - Buffer and Byte Offset to Put in sg_bindings (vertex_buffer_offsets/index_buffer_offset), Offset -1 on Failure
+    struct TransientAlloc {
+        sg_buffer buffer {};
+        int offset {-1};
+    };
+
+    // Transient Buffer Class - Frame-Scoped Linear Allocator Over Stream Buffers Filled With sg_append_buffer
+    // Allocations That Would Overflow Spill Into an Extra Buffer For The Rest of The Frame, The Next Frame Grows to Fit The Peak
+    class TransientBuffer {
+        public:
+            // Constructor - Buffer Type (Vertex or Index) and Initial Capacity in Bytes
+            TransientBuffer(const sg_buffer_type &type, const size_t &initialCapacity);
+
+            // Start a New Frame - Call Once Per Frame Before Allocating, Merges Last Frame's Spill Buffers Into One Big Enough Buffer
+            void beginFrame(void);
+
+            // Append Data For This Frame - Valid Until The Frame Is Committed
+            TransientAlloc alloc(const sg_range &data);
+
+            // Getters
+            size_t getFrameUsage(void);
+            size_t getPeakUsage(void);
+            size_t getCapacity(void);
+        private:
+            // Stream Buffer and Its Capacity and Append Position This Frame
+            struct Block {
+                BufferHandle buffer;
+                size_t capacity;
+                size_t usage {0};
+            };
+
+            // Create a Stream Buffer Block
+            void addBlock(const size_t &capacity);
+
+            // Buffer Type and Blocks - Only The First Block Is Used Unless a Frame Overflows It
+            sg_buffer_type type;
+            std::vector<Block> blocks;
+
+            // Bytes Allocated This Frame and Most Bytes Allocated in Any Frame
+            size_t frameUsage {0}, peakUsage {0};
+    };
+
+    // Uniform Manager Class - Skips sg_apply_uniforms When a Block Is Identical to The One Last Applied to The Same Stage and Slot
+    // Blocks Are Rejected by Hash Then Compared Byte-Wise Against a Copy of The Applied Data, Sokol Forgets Applied Uniforms on a New Pipeline or Pass So Call reset() After Either
+    class UniformManager {
+        public:
+            // Uniform Manager Statistics - Accumulated Until resetStats()
+            struct Stats {
+                uint64_t applies {0}, skips {0};
+                uint64_t bytesUploaded {0}, bytesSkipped {0};
+            };
+
+            // Forget Applied Blocks - Call After sg_apply_pipeline or Beginning a Pass
+            void reset(void);
+
+            // Apply Uniform Block - Returns False If It Was Skipped Because The Same Data Is Already Applied
+            // Pass The Block's Hash (hashBytes of Its Data) When It's Known to Skip Hashing Blocks Applied Many Times
+            bool apply(const sg_shader_stage &stage, const int &slot, const sg_range &data);
+            bool apply(const sg_shader_stage &stage, const int &slot, const sg_range &data, const uint64_t &hash);
+
+            // Apply Uniform Block Without Checking It - For Data That Changes Every Draw (Per-Object Blocks), Where Hashing Would Never Pay Off
+            void applyChanged(const sg_shader_stage &stage, const int &slot, const sg_range &data);
+
+            // Start a New Frame - Bytes Uploaded Per Frame Are Counted From Here
+            void beginFrame(void);
+
+            // Reset Statistics
+            void resetStats(void);
+
+            // Getters
+            const Stats &getStats(void);
+            size_t getFrameBytes(void);
+            size_t getPeakFrameBytes(void);
+        private:
+            // Last Applied Block Per Stage and Slot - Hash and a Copy of Its Data, No Data When Nothing Is Applied or It Wasn't Hashed
+            struct AppliedBlock {
+                uint64_t hash {0};
+                std::vector<uint8_t> data;
+            };
+            AppliedBlock appliedBlocks[SG_NUM_SHADER_STAGES][SG_MAX_SHADERSTAGE_UBS] {};
+
+            // Record an Applied Block (Its Data Copied Only When hashed) and Count The Bytes Uploaded
+            void record(const sg_shader_stage &stage, const int &slot, const sg_range &data, const uint64_t &hash, const bool &hashed);
+
+            // Bytes Uploaded This Frame and Most Bytes Uploaded in Any Frame
+            size_t frameBytes {0}, peakFrameBytes {0};
+
+            // Uniform Manager Statistics
+            Stats stats;
+    };
+
+    // Draw Packet - One Draw Submitted to a Render Queue
+    struct DrawPacket {
+        // Sort Key - Build With RenderQueue::makeSortKey
+        uint64_t sortKey {0};
+
+        // Pipeline and Bindings (Registered With RenderQueue::addBindings)
+        sg_pipeline pipeline {};
+        uint32_t bindingsId {0};
+
+        // Draw Range
+        int baseElement {0}, numElements {0}, numInstances {1};
+
+        // Shared Uniform Blocks Added With RenderQueue::addUniforms, RenderQueue::noUniforms For None - Applied Before The Packet's Own Uniforms
+        uint32_t frameUniformsId {UINT32_MAX}, materialUniformsId {UINT32_MAX};
+
+        // Per-Object Vertex Shader Uniform Block Slot, -1 For None - Uniform Data Is Copied by RenderQueue::submit and Always Applied
+        int vsUniformSlot {-1};
+        uint32_t uniformOffset {0}, uniformSize {0};
+    };
+
+    // Render Queue Class - Collects Draw Packets, Radix Sorts Them by Key and Skips Redundant State Changes
+    class RenderQueue {
+        public:
+            // Render Queue Statistics - Accumulated Until resetStats()
+            struct Stats {
+                uint64_t draws {0};
+                uint64_t pipelineApplies {0}, pipelineSkips {0};
+                uint64_t bindingsApplies {0}, bindingsSkips {0};
+            };
+
+            // Uniform Blocks ID Meaning None
+            static constexpr uint32_t noUniforms {UINT32_MAX};
+
+            // Bindings IDs Sort Keys Can Tell Apart - Registering More Live Bindings Than This Makes Unrelated Bindings Share Key Bits
+            static constexpr uint32_t maxBindings {1u << 20};
+
+            // Build Sort Key - Pass (4 Bits), Pipeline (16 Bits), Bindings (20 Bits), Depth in [0, 1] (24 Bits)
+            static uint64_t makeSortKey(const uint32_t &pass, const sg_pipeline &pipeline, const uint32_t &bindingsId, const float &depth);
+
+            // Register Bindings - Returns The Bindings ID Used by Draw Packets, Valid Until removeBindings() (IDs of Removed Bindings Are Reused)
+            uint32_t addBindings(const sg_bindings &bindings);
+
+            // Remove Registered Bindings - Packets Already Submitted With The ID Must Be Flushed First
+            void removeBindings(const uint32_t &bindingsId);
+
+            // Replace Registered Bindings - Packets Already Submitted With The ID Draw With The New Bindings at The Next flush()
+            void setBindings(const uint32_t &bindingsId, const sg_bindings &bindings);
+
+            // Add Shared Uniform Block (Per-Frame or Per-Material Data) - Copied, Returns The ID Draw Packets Reference Until The Next flush()
+            uint32_t addUniforms(const sg_shader_stage &stage, const int &slot, const sg_range &data);
+
+            // Submit Draw Packet - Uniform Data Is Copied So It Does Not Need to Outlive The Call
+            void submit(const DrawPacket &packet, const sg_range &vsUniforms = {});
+
+            // Sort Submitted Draw Packets by Key, Then Draw Them in Order and Clear The Queue - Call Inside a Render Pass
+            void flush(void);
+
+            // Reset Statistics
+            void resetStats(void);
+
+            // Getters
+            const Stats &getStats(void);
+            size_t getPacketCount(void);
+            uint64_t getFlushCount(void);
+            UniformManager &getUniformManager(void);
+        private:
+            // Shared Uniform Block - Stage, Slot, Where Its Data Is in uniformData and Its Hash (Computed Once When Added)
+            struct UniformBlock {
+                sg_shader_stage stage;
+                int slot;
+                uint32_t offset, size;
+                uint64_t hash;
+            };
+
+            // Sort Entry - Key and Index of The Packet It Belongs To
+            struct SortEntry {
+                uint64_t key;
+                uint32_t packetIndex;
+            };
+
+            // Radix Sort Sort Entries by Key - Eight Passes Over One Byte Each, Passes Where Every Key Has The Same Byte Are Skipped
+            void sort(void);
+
+            // Registered Bindings, Whether Each ID Is Registered and Removed IDs Free For Reuse
+            std::vector<sg_bindings> bindings;
+            std::vector<bool> bindingsRegistered;
+            std::vector<uint32_t> freeBindingsIds;
+
+            // Submitted Draw Packets, Shared Uniform Blocks, Uniform Data and Sort Entries (Plus Scratch Space For Sorting)
+            std::vector<DrawPacket> packets;
+            std::vector<UniformBlock> uniformBlocks;
+            std::vector<uint8_t> uniformData;
+            std::vector<SortEntry> sortEntries, sortScratch;
+
+            // Skips Uniform Blocks Already Applied With The Current Pipeline
+            UniformManager uniformManager;
+
+            // Number of Flushes - Shared Uniform Block IDs Are Only Valid Until The Next One
+            uint64_t flushCount {0};
+
+            // Render Queue Statistics
+            Stats stats;
+    };
+
+    // Material Class - Shader Permutation, Render State (Pipeline Desc and Pass), Textures, Samplers and Default Uniforms
+    // The Pipeline Is Created Once, Bindings Are Built Once Per Mesh and Cached, Submitted Draws Sort by Bindings So Draws Sharing a Material Batch Together
+    // A Material Is Submitted Through One Render Queue, Whose Bindings IDs It Caches and Removes When Destroyed - The Render Queue Must Outlive It
+    class Material {
+        public:
+            // Constructor - pipelineDesc Holds The Vertex Layout and Render State, The Registry Fills In The Permutation's Shader
+            Material(ShaderRegistry &shaderRegistry, const uint32_t &permutationMask, const sg_pipeline_desc &pipelineDesc, const uint32_t &pass = 0);
+
+            // Destructor - Remove The Material's Bindings From Its Render Queue
+            ~Material(void);
+
+            // Materials Cannot Be Copied, Only Moved - The Moved From Material No Longer Owns Any Bindings
+            Material(const Material&) = delete;
+            Material &operator=(const Material&) = delete;
+            Material(Material &&other) noexcept;
+            Material &operator=(Material&&) = delete;
+
+            // Set Texture and Sampler - Cached Bindings Are Rebuilt Under Their Existing IDs, So Packets Keep Batching
+            void setTexture(const sg_shader_stage &stage, const int &imageSlot, const sg_image &image, const int &samplerSlot, const sg_sampler &sampler);
+
+            // Set Default Uniforms - The Material's Uniform Block, Copied and Applied Once Per Batch
+            void setUniforms(const sg_shader_stage &stage, const int &slot, const sg_range &data);
+
+            // Submit Draw Packet - Fills In Pipeline, Bindings (meshBindings' Buffers Plus The Material's Textures), Material Uniforms and Sort Key
+            // The Packet Brings Its Draw Range, Frame Uniforms and Per-Object Uniform Slot
+            void submit(RenderQueue &renderQueue, DrawPacket packet, const sg_bindings &meshBindings, const float &depth, const sg_range &objectUniforms = {});
+
+            // Getters
+            sg_pipeline getPipeline(void);
+            size_t getBindingsCount(void);
+        private:
+            // Pipeline and Pass
+            sg_pipeline pipeline {};
+            uint32_t pass {0};
+
+            // Textures and Samplers - Only The Image and Sampler Slots Are Used
+            sg_bindings textures {};
+
+            // Default Uniforms - Stage, Slot and Data, Slot -1 For None
+            sg_shader_stage uniformsStage {SG_SHADERSTAGE_FS};
+            int uniformsSlot {-1};
+            std::vector<uint8_t> uniformData;
+
+            // Mesh Buffers Part of a Bindings - Vertex and Index Buffers and Their Offsets
+            struct MeshBuffers {
+                sg_buffer vertexBuffers[SG_MAX_VERTEX_BUFFERS];
+                int vertexBufferOffsets[SG_MAX_VERTEX_BUFFERS];
+                sg_buffer indexBuffer;
+                int indexBufferOffset;
+                bool operator==(const MeshBuffers &other) const;
+            };
+            struct MeshBuffersHash {
+                size_t operator()(const MeshBuffers &meshBuffers) const;
+            };
+
+            // Bindings For Mesh Buffers - The Material's Textures Plus The Buffers
+            sg_bindings makeBindings(const MeshBuffers &meshBuffers);
+
+            // Render Queue Submitted Through, Its Bindings IDs Keyed by Mesh Buffers (Kept So They Can Be Rebuilt When a Texture Changes) and The Uniform Block ID For Its Current Flush
+            // The Last Mesh Buffers and Their Bindings ID Are Kept So Runs of Draws With The Same Mesh Skip The Lookup
+            RenderQueue *renderQueue {nullptr};
+            std::unordered_map<MeshBuffers, uint32_t, MeshBuffersHash> bindingsIds;
+            MeshBuffers lastMeshBuffers {};
+            uint32_t lastBindingsId {UINT32_MAX};
+            uint32_t uniformsId {RenderQueue::noUniforms};
+            uint64_t uniformsFlush {UINT64_MAX};
+    };
+
+    // Frame Profiler Class - Hierarchical CPU Zones Per Frame on sokol_time, Keeps The Last N Frames in a Ring Buffer
+    // Main Thread Only, Zone and Counter Names Must Outlive The Profiler (String Literals)
+    class Profiler {
+        public:
+            // Zone - Name, Start and End Ticks (stm_now) and Index of The Enclosing Zone (-1 For Top Level)
+            struct Zone {
+                const char* name;
+                uint64_t start, end;
+                int parent, depth;
+            };
+
+            // Counter - Name and Value Set During a Frame
+            struct Counter {
+                const char* name;
+                double value;
+            };
+
+            // Frame - Start and End Ticks, Ticks Since The Previous Frame Started, Zones in Open Order, Counters and Sokol's Stats For It
+            struct Frame {
+                uint64_t index {0};
+                uint64_t start {0}, end {0}, interval {0};
+                std::vector<Zone> zones;
+                std::vector<Counter> counters;
+                sg_frame_stats stats {};
+            };
+
+            // Constructor - Number of Frames Kept
+            Profiler(const int &maxFrames);
+
+            // Begin / End Frame - End After sg_commit So The Frame's Sokol Stats Are Captured
+            void beginFrame(void);
+            void endFrame(void);
+
+            // Begin / End Zone - Zones Nest, SGL_PROFILE_SCOPE Ends The Zone With The Enclosing Scope
+            void beginZone(const char* name);
+            void endZone(void);
+
+            // Set Counter For The Current Frame - Setting It Again Replaces The Value
+            void setCounter(const char* name, const double &value);
+
+            // Write Recorded Frames as a Chrome Trace (chrome://tracing, Perfetto) - Zones as Events, Counters and Sokol Stats as Counters
+            bool writeChromeTrace(const std::filesystem::path &path);
+
+            // Getters - framesAgo 0 Is The Last Completed Frame, nullptr When Not Recorded
+            const Frame* getFrame(const int &framesAgo);
+            int getFrameCount(void);
+        private:
+            // Frame Ring Buffer and Number of Frames Completed
+            std::vector<Frame> frames;
+            uint64_t frameCount {0};
+
+            // Frame Being Recorded and Its Open Zones
+            bool inFrame {false};
+            std::vector<int> openZones;
+
+            // Start of The Previous Frame For stm_laptime
+            uint64_t lastFrameStart {0};
+    };
+
+    // Profile Scope Class - Zone That Ends When The Scope Does
+    class ProfileScope {
+        public:
+            // Constructor / Destructor - Begin / End Zone
+            ProfileScope(Profiler &profiler, const char* name) : profiler(profiler) {this->profiler.beginZone(name);}
+            ~ProfileScope(void) {this->profiler.endZone();}
+
+            // Scopes Cannot Be Copied
+            ProfileScope(const ProfileScope&) = delete;
+            ProfileScope &operator=(const ProfileScope&) = delete;
+        private:
+            Profiler &profiler;
     };
 
     // Camera Class
@@ -39,8 +1440,10 @@ namespace sgl {
             // Constructor - Initialize The Camera
             Camera(const glm::vec3 &position, const glm::vec3 &front, const float &moveSpeed, const float &lookSpeed, const float &fov, const float &minFOV, const float &maxFOV);
 
+#ifndef SGL_HEADLESS
             // Process Keyboard Input
             void processKeyboard(GLFWwindow* win, const float &deltaTime);
+#endif
 
             // Process Mouse Movement (Look Around) / Scroll (Zoom In/Out)
             void processMouse(const double &scrollPosX, const double &scrollPosY);
@@ -48,12 +1451,19 @@ namespace sgl {
 
             // Getters
             glm::mat4 getViewMat(void);
+            glm::mat4 getProjectionMat(void);
+            glm::mat4 getViewProjMat(void);
             glm::vec3 getPos(void);
             glm::vec3 getFront(void);
             float getFOV(void);
+            float getAspectRatio(void);
+            float getNearPlane(void);
+            float getFarPlane(void);
 
             // Setters
             void setFirstMouse(const bool &value);
+            void setAspectRatio(const float &aspectRatio);
+            void setClipPlanes(const float &nearPlane, const float &farPlane);
         private:
             // Position, Front and Up Vector
             glm::vec3 position, front, up {0.0f, 1.0f, 0.0f};
@@ -64,6 +1474,9 @@ namespace sgl {
             // FOV
             float fov, minFOV, maxFOV;
 
+            // Projection - Aspect Ratio (Width / Height) and Near/Far Clip Planes
+            float aspectRatio {4.0f / 3.0f}, nearPlane {0.1f}, farPlane {100.0f};
+
             // Mouse Entered The Window For The First Time
             bool firstMouse {true};
 
@@ -0,0 +1,23 @@
+#include"../Engine.hpp"
+
+// Bounds of This Box After a Transform - Transformed Center Plus Extents Through The Absolute Rotation/Scale Part
+sgl::AABB sgl::AABB::transform(const glm::mat4 &matrix) const {
+    const glm::vec3 center {matrix * glm::vec4(this->getCenter(), 1.0f)};
+    const glm::vec3 extents {this->getExtents()};
+    const glm::vec3 worldExtents {
+        glm::abs(glm::vec3(matrix[0])) * extents.x +
+        glm::abs(glm::vec3(matrix[1])) * extents.y +
+        glm::abs(glm::vec3(matrix[2])) * extents.z
+    };
+    return {center - worldExtents, center + worldExtents};
+}
+
+// Grow to Contain Another Box
+void sgl::AABB::merge(const AABB &other) {
+    this->min = glm::min(this->min, other.min);
+    this->max = glm::max(this->max, other.max);
+}
+
+// Getters
+glm::vec3 sgl::AABB::getCenter(void) const {return (this->min + this->max) * 0.5f;}
+glm::vec3 sgl::AABB::getExtents(void) const {return (this->max - this->min) * 0.5f;}
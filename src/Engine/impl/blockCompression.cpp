@@ -0,0 +1,101 @@
+#include"../Engine.hpp"
+
+// Expand an RGB565 Color to RGBA8
+static void unpackRGB565(const uint16_t &color, uint8_t* rgba) {
+    rgba[0] = static_cast<uint8_t>(((color >> 11) & 0x1f) * 255 / 31);
+    rgba[1] = static_cast<uint8_t>(((color >> 5) & 0x3f) * 255 / 63);
+    rgba[2] = static_cast<uint8_t>((color & 0x1f) * 255 / 31);
+    rgba[3] = 255;
+}
+
+// Decode a BC1 Color Block Into a 4x4 RGBA8 Texel Block - BC3 Color Blocks Always Use The Four Color Mode
+static void decodeColorBlock(const uint8_t* block, const bool &forceFourColors, uint8_t texels[16][4]) {
+    // Endpoint Colors
+    const uint16_t color0 {static_cast<uint16_t>(block[0] | (block[1] << 8))};
+    const uint16_t color1 {static_cast<uint16_t>(block[2] | (block[3] << 8))};
+    uint8_t palette[4][4];
+    unpackRGB565(color0, palette[0]);
+    unpackRGB565(color1, palette[1]);
+
+    // Interpolated Colors - Two Thirds/One Third, or Half and Transparent Black
+    for(int c {0}; c < 3; c++) {
+        if(forceFourColors || color0 > color1) {
+            palette[2][c] = static_cast<uint8_t>((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = static_cast<uint8_t>((palette[0][c] + 2 * palette[1][c]) / 3);
+        } else {
+            palette[2][c] = static_cast<uint8_t>((palette[0][c] + palette[1][c]) / 2);
+            palette[3][c] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = (forceFourColors || color0 > color1) ? 255 : 0;
+
+    // Two Bit Palette Index Per Texel
+    const uint32_t indices {static_cast<uint32_t>(block[4] | (block[5] << 8) | (block[6] << 16) | (static_cast<uint32_t>(block[7]) << 24))};
+    for(int texel {0}; texel < 16; texel++) {
+        std::memcpy(texels[texel], palette[(indices >> (texel * 2)) & 0x3], 4);
+    }
+}
+
+// Decode a BC3 Alpha Block Into The Alpha Channel of a 4x4 RGBA8 Texel Block
+static void decodeAlphaBlock(const uint8_t* block, uint8_t texels[16][4]) {
+    // Endpoint Alphas and Interpolated Alphas - Eight Step, or Six Step Plus Fully Transparent/Opaque
+    uint8_t palette[8] {block[0], block[1]};
+    for(int i {1}; i < 7; i++) {
+        if(block[0] > block[1]) {
+            palette[i + 1] = static_cast<uint8_t>(((7 - i) * block[0] + i * block[1]) / 7);
+        } else if(i < 5) {
+            palette[i + 1] = static_cast<uint8_t>(((5 - i) * block[0] + i * block[1]) / 5);
+        }
+    }
+    if(block[0] <= block[1]) {
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    // Three Bit Palette Index Per Texel
+    uint64_t indices {0};
+    for(int i {0}; i < 6; i++) {
+        indices |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+    }
+    for(int texel {0}; texel < 16; texel++) {
+        texels[texel][3] = palette[(indices >> (texel * 3)) & 0x7];
+    }
+}
+
+// Check if a Pixel Format Is a Block Compressed Format Handled by The Engine
+bool sgl::isBlockCompressedFormat(const sg_pixel_format &pixelFormat) {
+    return pixelFormat == SG_PIXELFORMAT_BC1_RGBA || pixelFormat == SG_PIXELFORMAT_BC3_RGBA;
+}
+
+// Size in Bytes of a Block Compressed Image - 4x4 Texel Blocks, 8 Bytes (BC1) or 16 Bytes (BC3) Each
+size_t sgl::getBlockCompressedSize(const sg_pixel_format &pixelFormat, const int &width, const int &height) {
+    const size_t blockSize {pixelFormat == SG_PIXELFORMAT_BC1_RGBA ? 8u : 16u};
+    return static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4) * blockSize;
+}
+
+// Decompress a BC1/BC3 Image to RGBA8 - Fallback When The Backend Cannot Sample The Format
+void sgl::decompressBlockImage(const uint8_t* blocks, const sg_pixel_format &pixelFormat, const int &width, const int &height, uint8_t* rgba) {
+    const bool hasAlphaBlock {pixelFormat == SG_PIXELFORMAT_BC3_RGBA};
+    for(int blockY {0}; blockY < height; blockY += 4) {
+        for(int blockX {0}; blockX < width; blockX += 4) {
+            // Decode Block
+            uint8_t texels[16][4];
+            if(hasAlphaBlock) {
+                decodeColorBlock(blocks + 8, true, texels);
+                decodeAlphaBlock(blocks, texels);
+                blocks += 16;
+            } else {
+                decodeColorBlock(blocks, false, texels);
+                blocks += 8;
+            }
+
+            // Copy Texels That Lie Inside The Image - Edge Blocks Are Padded
+            for(int y {0}; y < 4 && blockY + y < height; y++) {
+                for(int x {0}; x < 4 && blockX + x < width; x++) {
+                    std::memcpy(rgba + (static_cast<size_t>(blockY + y) * width + blockX + x) * 4, texels[y * 4 + x], 4);
+                }
+            }
+        }
+    }
+}
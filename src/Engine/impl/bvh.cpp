@@ -0,0 +1,485 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<limits>
+
+// SAH Bins Per Axis, Proxies Below Which Ranges Are Split at The Median Instead and Above Which a Subtree Is Built as a Separate Job
+static const int sahBinCount {16};
+static const uint32_t sahMinProxies {8};
+static const uint32_t parallelBuildThreshold {4096};
+
+// Surface Area of a Box
+static float surfaceArea(const sgl::AABB &aabb) {
+    const glm::vec3 size {aabb.max - aabb.min};
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+// Box Containing Two Boxes
+static sgl::AABB merged(const sgl::AABB &a, const sgl::AABB &b) {
+    return {glm::min(a.min, b.min), glm::max(a.max, b.max)};
+}
+
+// Build From Scratch - Proxy i Gets bounds[i], Large Subtrees Are Built as Jobs When a Job System Is Given
+void sgl::BVH::build(const std::vector<AABB> &bounds, JobSystem* jobSystem) {
+    std::vector<BuildProxy> proxies(bounds.size());
+    for(size_t i {0}; i < bounds.size(); i++) {
+        proxies[i] = {bounds[i], bounds[i].getCenter(), static_cast<ProxyId>(i)};
+    }
+    this->proxyNodes.assign(bounds.size(), invalidNode);
+    this->freeProxies.clear();
+    this->buildFrom(proxies, jobSystem);
+}
+
+// Rebuild From The Current Proxies' Bounds Keeping Their IDs - Restores Tree Quality After Many Inserts or Large Moves
+void sgl::BVH::rebuild(JobSystem* jobSystem) {
+    std::vector<BuildProxy> proxies;
+    proxies.reserve(this->getProxyCount());
+    for(ProxyId proxy {0}; proxy < this->proxyNodes.size(); proxy++) {
+        if(this->proxyNodes[proxy] == invalidNode) continue;
+        const AABB &bounds {this->nodes[this->proxyNodes[proxy]].bounds};
+        proxies.push_back({bounds, bounds.getCenter(), proxy});
+    }
+    this->buildFrom(proxies, jobSystem);
+}
+
+// Insert Proxy - Descends Towards The Sibling That Grows The Tree's Surface Area Least
+sgl::BVH::ProxyId sgl::BVH::insert(const AABB &bounds) {
+    // Proxy ID - Reuse a Freed One if Possible
+    ProxyId proxy {static_cast<ProxyId>(this->proxyNodes.size())};
+    if(!this->freeProxies.empty()) {
+        proxy = this->freeProxies.back();
+        this->freeProxies.pop_back();
+    } else {
+        this->proxyNodes.push_back(invalidNode);
+    }
+
+    // Leaf Node
+    const uint32_t leaf {this->allocNode()};
+    this->nodes[leaf] = {bounds, invalidNode, proxy};
+    this->proxyNodes[proxy] = leaf;
+    this->refitOrderDirty = true;
+    if(this->root == invalidNode) {
+        this->root = leaf;
+        return proxy;
+    }
+
+    // Find Sibling - Stop Where Pairing With The Current Node Costs Less Than Descending Into Either Child
+    uint32_t sibling {this->root};
+    while(this->nodes[sibling].left != invalidNode) {
+        const Node &node {this->nodes[sibling]};
+        const float combinedArea {surfaceArea(merged(node.bounds, bounds))};
+        const float cost {2.0f * combinedArea};
+        const float inheritedCost {2.0f * (combinedArea - surfaceArea(node.bounds))};
+        const auto childCost = [&](const uint32_t &child) {
+            const Node &childNode {this->nodes[child]};
+            const float grownArea {surfaceArea(merged(childNode.bounds, bounds))};
+            return (childNode.left == invalidNode ? grownArea : grownArea - surfaceArea(childNode.bounds)) + inheritedCost;
+        };
+        const float leftCost {childCost(node.left)}, rightCost {childCost(node.right)};
+        if(cost < leftCost && cost < rightCost) break;
+        sibling = leftCost < rightCost ? node.left : node.right;
+    }
+
+    // New Parent of The Sibling and The Leaf Takes The Sibling's Place
+    const uint32_t oldParent {this->parents[sibling]};
+    const uint32_t newParent {this->allocNode()};
+    this->nodes[newParent] = {merged(this->nodes[sibling].bounds, bounds), sibling, leaf};
+    this->parents[newParent] = oldParent;
+    this->parents[sibling] = newParent;
+    this->parents[leaf] = newParent;
+    if(oldParent == invalidNode) {
+        this->root = newParent;
+    } else {
+        Node &oldParentNode {this->nodes[oldParent]};
+        (oldParentNode.left == sibling ? oldParentNode.left : oldParentNode.right) = newParent;
+        this->refitAncestors(oldParent);
+    }
+    return proxy;
+}
+
+// Remove Proxy
+void sgl::BVH::remove(const ProxyId &proxy) {
+    if(proxy >= this->proxyNodes.size() || this->proxyNodes[proxy] == invalidNode) return;
+    const uint32_t leaf {this->proxyNodes[proxy]};
+    const uint32_t parent {this->parents[leaf]};
+    this->proxyNodes[proxy] = invalidNode;
+    this->freeProxies.push_back(proxy);
+    this->refitOrderDirty = true;
+    this->freeNode(leaf);
+    if(parent == invalidNode) {
+        this->root = invalidNode;
+        return;
+    }
+
+    // The Leaf's Sibling Takes The Parent's Place
+    const uint32_t sibling {this->nodes[parent].left == leaf ? this->nodes[parent].right : this->nodes[parent].left};
+    const uint32_t grandParent {this->parents[parent]};
+    this->freeNode(parent);
+    this->parents[sibling] = grandParent;
+    if(grandParent == invalidNode) {
+        this->root = sibling;
+    } else {
+        Node &grandParentNode {this->nodes[grandParent]};
+        (grandParentNode.left == parent ? grandParentNode.left : grandParentNode.right) = sibling;
+        this->refitAncestors(grandParent);
+    }
+}
+
+// Set a Proxy's Bounds - Ancestors Are Fixed by The Next refit, Safe to Call From Several Threads For Different Proxies
+void sgl::BVH::setBounds(const ProxyId &proxy, const AABB &bounds) {
+    this->nodes[this->proxyNodes[proxy]].bounds = bounds;
+}
+
+// Set a Proxy's Bounds and Refit Its Ancestors Right Away - For a Few Moving Objects Among Many Static Ones
+void sgl::BVH::updateBounds(const ProxyId &proxy, const AABB &bounds) {
+    const uint32_t leaf {this->proxyNodes[proxy]};
+    this->nodes[leaf].bounds = bounds;
+    this->refitAncestors(this->parents[leaf]);
+}
+
+// Recompute Every Internal Node's Bounds From Its Children, Children Before Parents
+void sgl::BVH::refit(void) {
+    // Internal Nodes in Reverse Depth-First Order - Set by build, Walked Again After Inserts and Removals
+    if(this->refitOrderDirty) {
+        this->refitOrder.clear();
+        std::vector<uint32_t> stack;
+        if(this->root != invalidNode) stack.push_back(this->root);
+        while(!stack.empty()) {
+            const uint32_t node {stack.back()};
+            stack.pop_back();
+            if(this->nodes[node].left == invalidNode) continue;
+            this->refitOrder.push_back(node);
+            stack.push_back(this->nodes[node].right);
+            stack.push_back(this->nodes[node].left);
+        }
+        std::reverse(this->refitOrder.begin(), this->refitOrder.end());
+        this->refitOrderDirty = false;
+    }
+
+    // Recompute Bounds
+    for(const uint32_t &node : this->refitOrder) {
+        Node &internalNode {this->nodes[node]};
+        internalNode.bounds = merged(this->nodes[internalNode.left].bounds, this->nodes[internalNode.right].bounds);
+    }
+}
+
+// Queries - Append Proxies Whose Bounds Intersect, Return The Number Appended
+// Planes a Node Is Fully Inside Are Skipped For Its Children, Subtrees Fully Inside Every Plane Are Appended Without Tests
+size_t sgl::BVH::query(const Frustum &frustum, std::vector<ProxyId> &results) const {
+    const size_t firstResult {results.size()};
+    if(this->root == invalidNode) return 0;
+    glm::vec4 planes[6];
+    for(int i {0}; i < 6; i++) planes[i] = frustum.getPlane(i);
+
+    // Nodes to Visit and The Planes Still Intersecting Their Parent
+    std::vector<std::pair<uint32_t, uint8_t>> stack {{this->root, 0x3F}};
+    while(!stack.empty()) {
+        const auto [node, parentMask] {stack.back()};
+        stack.pop_back();
+        const Node &bvhNode {this->nodes[node]};
+        const glm::vec3 center {bvhNode.bounds.getCenter()}, extents {bvhNode.bounds.getExtents()};
+
+        // Test Remaining Planes - Outside One Rejects The Node, Fully Inside One Drops It From The Mask
+        uint8_t mask {parentMask};
+        bool outside {false};
+        for(int i {0}; i < 6 && !outside; i++) {
+            if(!(mask & (1 << i))) continue;
+            const float distance {glm::dot(glm::vec3(planes[i]), center) + planes[i].w};
+            const float reach {glm::dot(glm::abs(glm::vec3(planes[i])), extents)};
+            if(distance + reach < 0.0f) outside = true;
+            else if(distance - reach >= 0.0f) mask &= static_cast<uint8_t>(~(1 << i));
+        }
+        if(outside) continue;
+
+        // Fully Inside, a Visible Leaf or Descend
+        if(mask == 0) {
+            this->appendSubtree(node, results);
+        } else if(bvhNode.left == invalidNode) {
+            results.push_back(bvhNode.right);
+        } else {
+            stack.push_back({bvhNode.right, mask});
+            stack.push_back({bvhNode.left, mask});
+        }
+    }
+    return results.size() - firstResult;
+}
+size_t sgl::BVH::query(const AABB &aabb, std::vector<ProxyId> &results) const {
+    const size_t firstResult {results.size()};
+    if(this->root == invalidNode) return 0;
+    std::vector<uint32_t> stack {this->root};
+    while(!stack.empty()) {
+        const Node &node {this->nodes[stack.back()]};
+        stack.pop_back();
+        if(glm::any(glm::lessThan(node.bounds.max, aabb.min)) || glm::any(glm::greaterThan(node.bounds.min, aabb.max))) continue;
+        if(node.left == invalidNode) {
+            results.push_back(node.right);
+        } else {
+            stack.push_back(node.right);
+            stack.push_back(node.left);
+        }
+    }
+    return results.size() - firstResult;
+}
+
+// Ray Cast - Nearest Proxy Whose Bounds The Ray Hits Within maxDistance, False if None
+// Children Are Visited Nearest First and Nodes Entered Beyond The Closest Hit So Far Are Skipped
+bool sgl::BVH::raycast(const glm::vec3 &origin, const glm::vec3 &direction, const float &maxDistance, RayHit &hit) const {
+    if(this->root == invalidNode) return false;
+    const glm::vec3 invDirection {1.0f / direction};
+    float closest {maxDistance};
+    ProxyId closestProxy {invalidProxy};
+
+    // Slab Test - Distance The Ray Enters a Box, False if It Misses or Enters Beyond The Closest Hit
+    const auto enterDistance = [&](const AABB &bounds, float &distance) {
+        const glm::vec3 t0 {(bounds.min - origin) * invDirection}, t1 {(bounds.max - origin) * invDirection};
+        const glm::vec3 tNear {glm::min(t0, t1)}, tFar {glm::max(t0, t1)};
+        distance = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        return distance <= std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, closest));
+    };
+
+    // Nodes to Visit and The Distance The Ray Enters Them
+    std::vector<std::pair<uint32_t, float>> stack;
+    float rootDistance;
+    if(enterDistance(this->nodes[this->root].bounds, rootDistance)) stack.push_back({this->root, rootDistance});
+    while(!stack.empty()) {
+        const auto [node, distance] {stack.back()};
+        stack.pop_back();
+        if(distance > closest) continue;
+        const Node &bvhNode {this->nodes[node]};
+        if(bvhNode.left == invalidNode) {
+            closest = distance;
+            closestProxy = bvhNode.right;
+            continue;
+        }
+
+        // Push The Farther Child First So The Nearer One Is Visited Next
+        float leftDistance, rightDistance;
+        const bool hitLeft {enterDistance(this->nodes[bvhNode.left].bounds, leftDistance)};
+        const bool hitRight {enterDistance(this->nodes[bvhNode.right].bounds, rightDistance)};
+        if(hitLeft && hitRight) {
+            const bool leftFirst {leftDistance <= rightDistance};
+            stack.push_back(leftFirst ? std::make_pair(bvhNode.right, rightDistance) : std::make_pair(bvhNode.left, leftDistance));
+            stack.push_back(leftFirst ? std::make_pair(bvhNode.left, leftDistance) : std::make_pair(bvhNode.right, rightDistance));
+        } else if(hitLeft) {
+            stack.push_back({bvhNode.left, leftDistance});
+        } else if(hitRight) {
+            stack.push_back({bvhNode.right, rightDistance});
+        }
+    }
+    if(closestProxy == invalidProxy) return false;
+    hit = {closestProxy, closest};
+    return true;
+}
+
+// Getters
+const sgl::AABB &sgl::BVH::getBounds(const ProxyId &proxy) const {return this->nodes[this->proxyNodes[proxy]].bounds;}
+size_t sgl::BVH::getProxyCount(void) const {return this->proxyNodes.size() - this->freeProxies.size();}
+size_t sgl::BVH::getNodeCount(void) const {return this->nodes.size() - this->freeNodes.size();}
+
+// Surface Area Heuristic Cost - Internal Nodes' Surface Area Relative to The Root's, Lower Is a Better Tree
+float sgl::BVH::getCost(void) const {
+    if(this->root == invalidNode) return 0.0f;
+    const float rootArea {surfaceArea(this->nodes[this->root].bounds)};
+    if(rootArea <= 0.0f) return 0.0f;
+    double area {0.0};
+    std::vector<uint32_t> stack {this->root};
+    while(!stack.empty()) {
+        const Node &node {this->nodes[stack.back()]};
+        stack.pop_back();
+        if(node.left == invalidNode) continue;
+        area += surfaceArea(node.bounds);
+        stack.push_back(node.left);
+        stack.push_back(node.right);
+    }
+    return static_cast<float>(area / rootArea);
+}
+
+// Replace The Tree With One Built Over proxies
+void sgl::BVH::buildFrom(std::vector<BuildProxy> &proxies, JobSystem* jobSystem) {
+    const uint32_t proxyCount {static_cast<uint32_t>(proxies.size())};
+    this->nodes.assign(proxyCount > 0 ? 2 * proxyCount - 1 : 0, Node {});
+    this->parents.assign(this->nodes.size(), invalidNode);
+    this->freeNodes.clear();
+    this->root = proxyCount > 0 ? 0 : invalidNode;
+    this->refitOrder.clear();
+    this->refitOrderDirty = false;
+    if(proxyCount == 0) return;
+
+    // Build - Jobs Write Disjoint Node and Proxy Ranges, So They Need No Locking
+    if(jobSystem) {
+        JobCounter counter;
+        this->buildNodes(proxies.data(), 0, proxyCount, 0, invalidNode, jobSystem, &counter);
+        jobSystem->wait(counter);
+    } else {
+        this->buildNodes(proxies.data(), 0, proxyCount, 0, invalidNode, nullptr, nullptr);
+    }
+
+    // Depth-First Layout - Every Child Follows Its Parent, So Internal Nodes From The Back Have Children Before Parents
+    this->refitOrder.reserve(proxyCount - 1);
+    for(uint32_t node {static_cast<uint32_t>(this->nodes.size())}; node-- > 0;) {
+        if(this->nodes[node].left != invalidNode) this->refitOrder.push_back(node);
+    }
+}
+
+// Build The Subtree of proxies[begin, end) at nodeIndex - Subtrees of n Proxies Take 2n - 1 Nodes, Left Child First
+void sgl::BVH::buildNodes(BuildProxy* proxies, const uint32_t &begin, const uint32_t &end, const uint32_t &nodeIndex, const uint32_t &parent, JobSystem* jobSystem, JobCounter* counter) {
+    // Subtrees Left to Build - Proxy Range, Node Index and Parent
+    struct Task {
+        uint32_t begin, end, node, parent;
+    };
+    std::vector<Task> tasks {{begin, end, nodeIndex, parent}};
+    while(!tasks.empty()) {
+        const Task task {tasks.back()};
+        tasks.pop_back();
+        this->parents[task.node] = task.parent;
+        Node &node {this->nodes[task.node]};
+
+        // Leaf
+        if(task.end - task.begin == 1) {
+            node = {proxies[task.begin].bounds, invalidNode, proxies[task.begin].proxy};
+            this->proxyNodes[proxies[task.begin].proxy] = task.node;
+            continue;
+        }
+
+        // Node Bounds and Bounds of The Proxies' Centroids
+        node.bounds = proxies[task.begin].bounds;
+        AABB centroidBounds {proxies[task.begin].centroid, proxies[task.begin].centroid};
+        for(uint32_t i {task.begin + 1}; i < task.end; i++) {
+            node.bounds.merge(proxies[i].bounds);
+            centroidBounds.min = glm::min(centroidBounds.min, proxies[i].centroid);
+            centroidBounds.max = glm::max(centroidBounds.max, proxies[i].centroid);
+        }
+
+        // Small Range - Split at The Median Along The Longest Centroid Axis, Binning Costs More Than It Gains This Close to The Leaves
+        const glm::vec3 centroidExtent {centroidBounds.max - centroidBounds.min};
+        if(task.end - task.begin < sahMinProxies) {
+            const int axis {centroidExtent.x >= centroidExtent.y && centroidExtent.x >= centroidExtent.z ? 0 : (centroidExtent.y >= centroidExtent.z ? 1 : 2)};
+            const uint32_t middle {task.begin + (task.end - task.begin) / 2};
+            std::nth_element(proxies + task.begin, proxies + middle, proxies + task.end, [&](const BuildProxy &a, const BuildProxy &b) {
+                return a.centroid[axis] < b.centroid[axis];
+            });
+            node.left = task.node + 1;
+            node.right = task.node + 2 * (middle - task.begin);
+            tasks.push_back({middle, task.end, node.right, task.node});
+            tasks.push_back({task.begin, middle, node.left, task.node});
+            continue;
+        }
+
+        // Binned SAH - Bin Centroids Along All Three Axes in One Pass, Then Pick The Bin Boundary With The Lowest Area * Count Cost
+        const glm::vec3 binScale {
+            centroidExtent.x > 0.0f ? sahBinCount / centroidExtent.x : 0.0f,
+            centroidExtent.y > 0.0f ? sahBinCount / centroidExtent.y : 0.0f,
+            centroidExtent.z > 0.0f ? sahBinCount / centroidExtent.z : 0.0f
+        };
+        AABB binBounds[3][sahBinCount];
+        uint32_t binCounts[3][sahBinCount] {};
+        for(uint32_t i {task.begin}; i < task.end; i++) {
+            const glm::ivec3 bins {glm::min(glm::ivec3((proxies[i].centroid - centroidBounds.min) * binScale), glm::ivec3(sahBinCount - 1))};
+            for(int axis {0}; axis < 3; axis++) {
+                if(binCounts[axis][bins[axis]]++ == 0) binBounds[axis][bins[axis]] = proxies[i].bounds;
+                else binBounds[axis][bins[axis]].merge(proxies[i].bounds);
+            }
+        }
+        int splitAxis {-1}, splitBin {0};
+        float splitCost {std::numeric_limits<float>::max()};
+        for(int axis {0}; axis < 3; axis++) {
+            if(centroidExtent[axis] <= 0.0f) continue;
+
+            // Sweep From The Right, Then From The Left Evaluating Each Boundary
+            float rightAreas[sahBinCount];
+            uint32_t rightCounts[sahBinCount];
+            AABB sweepBounds;
+            uint32_t sweepCount {0};
+            for(int bin {sahBinCount - 1}; bin > 0; bin--) {
+                if(binCounts[axis][bin] > 0) {
+                    if(sweepCount == 0) sweepBounds = binBounds[axis][bin];
+                    else sweepBounds.merge(binBounds[axis][bin]);
+                    sweepCount += binCounts[axis][bin];
+                }
+                rightAreas[bin] = sweepCount > 0 ? surfaceArea(sweepBounds) : 0.0f;
+                rightCounts[bin] = sweepCount;
+            }
+            sweepCount = 0;
+            for(int bin {0}; bin < sahBinCount - 1; bin++) {
+                if(binCounts[axis][bin] > 0) {
+                    if(sweepCount == 0) sweepBounds = binBounds[axis][bin];
+                    else sweepBounds.merge(binBounds[axis][bin]);
+                    sweepCount += binCounts[axis][bin];
+                }
+                if(sweepCount == 0 || rightCounts[bin + 1] == 0) continue;
+                const float cost {sweepCount * surfaceArea(sweepBounds) + rightCounts[bin + 1] * rightAreas[bin + 1]};
+                if(cost < splitCost) {
+                    splitCost = cost;
+                    splitAxis = axis;
+                    splitBin = bin;
+                }
+            }
+        }
+
+        // Partition at The Chosen Boundary - Every Centroid in The Same Spot Can't Be Binned, So Split The Range in Half
+        uint32_t middle {task.begin + (task.end - task.begin) / 2};
+        if(splitAxis >= 0) {
+            const float axisScale {binScale[splitAxis]}, axisMin {centroidBounds.min[splitAxis]};
+            middle = static_cast<uint32_t>(std::partition(proxies + task.begin, proxies + task.end, [&](const BuildProxy &proxy) {
+                return std::min(static_cast<int>((proxy.centroid[splitAxis] - axisMin) * axisScale), sahBinCount - 1) <= splitBin;
+            }) - proxies);
+        }
+
+        // Children - The Left Subtree Directly Follows Its Parent, The Right One Follows The Left Subtree
+        const Task left {task.begin, middle, task.node + 1, task.node};
+        const Task right {middle, task.end, task.node + 2 * (middle - task.begin), task.node};
+        node.left = left.node;
+        node.right = right.node;
+        if(jobSystem && right.end - right.begin >= parallelBuildThreshold) {
+            jobSystem->run([this, proxies, right, jobSystem, counter](void) {
+                this->buildNodes(proxies, right.begin, right.end, right.node, right.parent, jobSystem, counter);
+            }, counter);
+        } else {
+            tasks.push_back(right);
+        }
+        tasks.push_back(left);
+    }
+}
+
+// Allocate / Free a Node
+uint32_t sgl::BVH::allocNode(void) {
+    if(!this->freeNodes.empty()) {
+        const uint32_t node {this->freeNodes.back()};
+        this->freeNodes.pop_back();
+        return node;
+    }
+    this->nodes.emplace_back();
+    this->parents.push_back(invalidNode);
+    return static_cast<uint32_t>(this->nodes.size() - 1);
+}
+void sgl::BVH::freeNode(const uint32_t &node) {
+    this->nodes[node] = {};
+    this->parents[node] = invalidNode;
+    this->freeNodes.push_back(node);
+}
+
+// Recompute Bounds From node Up to The Root, Stopping Once an Ancestor's Bounds Don't Change
+void sgl::BVH::refitAncestors(uint32_t node) {
+    while(node != invalidNode) {
+        Node &internalNode {this->nodes[node]};
+        const AABB bounds {merged(this->nodes[internalNode.left].bounds, this->nodes[internalNode.right].bounds)};
+        if(bounds.min == internalNode.bounds.min && bounds.max == internalNode.bounds.max) break;
+        internalNode.bounds = bounds;
+        node = this->parents[node];
+    }
+}
+
+// Append Every Proxy in a Subtree
+void sgl::BVH::appendSubtree(const uint32_t &node, std::vector<ProxyId> &results) const {
+    std::vector<uint32_t> stack {node};
+    while(!stack.empty()) {
+        const Node &subtreeNode {this->nodes[stack.back()]};
+        stack.pop_back();
+        if(subtreeNode.left == invalidNode) {
+            results.push_back(subtreeNode.right);
+        } else {
+            stack.push_back(subtreeNode.right);
+            stack.push_back(subtreeNode.left);
+        }
+    }
+}
@@ -16,6 +16,7 @@ sgl::Camera::Camera(const glm::vec3 &position, const glm::vec3 &front, const flo
     this->maxFOV = maxFOV;
 }
 
+#ifndef SGL_HEADLESS
 // Process Keyboard Input
 void sgl::Camera::processKeyboard(GLFWwindow* win, const float &deltaTime) {
     // Move Around
@@ -29,6 +30,7 @@ void sgl::Camera::processKeyboard(GLFWwindow* win, const float &deltaTime) {
         this->position += glm::normalize(glm::cross(this->front, this->up)) * (this->moveSpeed * deltaTime);
     }
 }
+#endif
 
 // Process Mouse Movement (Look Around) / Scroll (Zoom In/Out)
 void sgl::Camera::processMouse(const double &mousePosX, const double &mousePosY) {
@@ -84,6 +86,21 @@ void sgl::Camera::processScroll(const double &scrollPosY) {
 
 // Getters
 glm::mat4 sgl::Camera::getViewMat(void) {return glm::lookAt(this->position, this->position + this->front, this->up);}
+glm::mat4 sgl::Camera::getProjectionMat(void) {return glm::perspective(glm::radians(this->fov), this->aspectRatio, this->nearPlane, this->farPlane);}
+glm::mat4 sgl::Camera::getViewProjMat(void) {return this->getProjectionMat() * this->getViewMat();}
 glm::vec3 sgl::Camera::getPos(void) {return this->position;}
 glm::vec3 sgl::Camera::getFront(void) {return this->front;}
 float sgl::Camera::getFOV(void) {return this->fov;}
+float sgl::Camera::getAspectRatio(void) {return this->aspectRatio;}
+float sgl::Camera::getNearPlane(void) {return this->nearPlane;}
+float sgl::Camera::getFarPlane(void) {return this->farPlane;}
+
+// Setters
+void sgl::Camera::setAspectRatio(const float &aspectRatio) {
+    // Ignore Zero-Sized Windows (Minimized) - Zero Width and/or Height Gives 0, NaN or Infinity
+    if(std::isfinite(aspectRatio) && aspectRatio > 0.0f) this->aspectRatio = aspectRatio;
+}
+void sgl::Camera::setClipPlanes(const float &nearPlane, const float &farPlane) {
+    this->nearPlane = nearPlane;
+    this->farPlane = farPlane;
+}
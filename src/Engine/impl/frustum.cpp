@@ -0,0 +1,237 @@
+#include"../Engine.hpp"
+
+// SIMD Intrinsics - AVX When The Compiler Targets It (-mavx, -march=native), SSE Otherwise
+#if defined(__AVX__)
+#include<immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include<emmintrin.h>
+#endif
+
+// Standard Headers
+#include<bit>
+
+// Objects Per Job When Culling in Parallel
+static const size_t cullGrainSize {16384};
+
+// Add / Replace Sphere
+void sgl::SphereArray::add(const glm::vec3 &center, const float &radius) {
+    this->centerX.push_back(center.x);
+    this->centerY.push_back(center.y);
+    this->centerZ.push_back(center.z);
+    this->radii.push_back(radius);
+}
+void sgl::SphereArray::set(const size_t &index, const glm::vec3 &center, const float &radius) {
+    this->centerX[index] = center.x;
+    this->centerY[index] = center.y;
+    this->centerZ[index] = center.z;
+    this->radii[index] = radius;
+}
+
+// Remove Every Sphere
+void sgl::SphereArray::clear(void) {
+    this->centerX.clear();
+    this->centerY.clear();
+    this->centerZ.clear();
+    this->radii.clear();
+}
+
+// Getters
+size_t sgl::SphereArray::getCount(void) const {return this->radii.size();}
+
+// Add / Replace Box
+void sgl::AABBArray::add(const AABB &aabb) {
+    const glm::vec3 center {aabb.getCenter()}, extents {aabb.getExtents()};
+    this->centerX.push_back(center.x);
+    this->centerY.push_back(center.y);
+    this->centerZ.push_back(center.z);
+    this->extentX.push_back(extents.x);
+    this->extentY.push_back(extents.y);
+    this->extentZ.push_back(extents.z);
+}
+void sgl::AABBArray::set(const size_t &index, const AABB &aabb) {
+    const glm::vec3 center {aabb.getCenter()}, extents {aabb.getExtents()};
+    this->centerX[index] = center.x;
+    this->centerY[index] = center.y;
+    this->centerZ[index] = center.z;
+    this->extentX[index] = extents.x;
+    this->extentY[index] = extents.y;
+    this->extentZ[index] = extents.z;
+}
+
+// Remove Every Box
+void sgl::AABBArray::clear(void) {
+    this->centerX.clear();
+    this->centerY.clear();
+    this->centerZ.clear();
+    this->extentX.clear();
+    this->extentY.clear();
+    this->extentZ.clear();
+}
+
+// Getters
+size_t sgl::AABBArray::getCount(void) const {return this->centerX.size();}
+
+// Constructor - Extract and Normalize Planes (Left, Right, Bottom, Top, Near, Far)
+sgl::Frustum::Frustum(const glm::mat4 &viewProjMatrix) {
+    // Rows of The Matrix - GLM Is Column-Major
+    const glm::mat4 rows {glm::transpose(viewProjMatrix)};
+
+    // Clip Space Is -w <= x, y, z <= w (OpenGL)
+    this->planes[0] = rows[3] + rows[0];
+    this->planes[1] = rows[3] - rows[0];
+    this->planes[2] = rows[3] + rows[1];
+    this->planes[3] = rows[3] - rows[1];
+    this->planes[4] = rows[3] + rows[2];
+    this->planes[5] = rows[3] - rows[2];
+
+    // Normalize So Distances Are in World Units (Needed For Sphere Radii)
+    for(glm::vec4 &plane : this->planes) {
+        plane /= glm::length(glm::vec3(plane));
+    }
+}
+
+// Single Tests - True When Inside or Intersecting
+bool sgl::Frustum::intersects(const glm::vec3 &center, const float &radius) const {
+    for(const glm::vec4 &plane : this->planes) {
+        if(glm::dot(glm::vec3(plane), center) + plane.w < -radius) return false;
+    }
+    return true;
+}
+bool sgl::Frustum::intersects(const AABB &aabb) const {
+    const glm::vec3 center {aabb.getCenter()}, extents {aabb.getExtents()};
+    for(const glm::vec4 &plane : this->planes) {
+        const float reach {glm::dot(glm::abs(glm::vec3(plane)), extents)};
+        if(glm::dot(glm::vec3(plane), center) + plane.w + reach < 0.0f) return false;
+    }
+    return true;
+}
+
+// Batched Tests - visible[i] Is 1 When Inside or Intersecting, 0 When Outside, Returns The Visible Count
+size_t sgl::Frustum::cull(const SphereArray &spheres, std::vector<uint8_t> &visible, JobSystem* jobSystem) const {
+    visible.resize(spheres.getCount());
+    if(!jobSystem) return this->cullSpheres(spheres, visible.data(), 0, spheres.getCount());
+    std::atomic<size_t> numVisible {0};
+    jobSystem->parallelFor(spheres.getCount(), cullGrainSize, [&](const size_t &begin, const size_t &end) {
+        numVisible.fetch_add(this->cullSpheres(spheres, visible.data(), begin, end), std::memory_order_relaxed);
+    });
+    return numVisible.load();
+}
+size_t sgl::Frustum::cull(const AABBArray &aabbs, std::vector<uint8_t> &visible, JobSystem* jobSystem) const {
+    visible.resize(aabbs.getCount());
+    if(!jobSystem) return this->cullAABBs(aabbs, visible.data(), 0, aabbs.getCount());
+    std::atomic<size_t> numVisible {0};
+    jobSystem->parallelFor(aabbs.getCount(), cullGrainSize, [&](const size_t &begin, const size_t &end) {
+        numVisible.fetch_add(this->cullAABBs(aabbs, visible.data(), begin, end), std::memory_order_relaxed);
+    });
+    return numVisible.load();
+}
+
+// Getters
+const glm::vec4 &sgl::Frustum::getPlane(const int &index) const {return this->planes[index];}
+
+// Cull a Range of Spheres - Outside When The Signed Distance to Any Plane Is Below -radius
+size_t sgl::Frustum::cullSpheres(const SphereArray &spheres, uint8_t* visible, const size_t &begin, const size_t &end) const {
+    const float* centerX {spheres.centerX.data()};
+    const float* centerY {spheres.centerY.data()};
+    const float* centerZ {spheres.centerZ.data()};
+    const float* radii {spheres.radii.data()};
+    size_t numVisible {0}, i {begin};
+#if defined(__AVX__)
+    // Eight Spheres at a Time
+    for(; i + 8 <= end; i += 8) {
+        const __m256 x {_mm256_loadu_ps(centerX + i)}, y {_mm256_loadu_ps(centerY + i)}, z {_mm256_loadu_ps(centerZ + i)};
+        const __m256 negRadius {_mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radii + i))};
+        __m256 inside {_mm256_castsi256_ps(_mm256_set1_epi32(-1))};
+        for(const glm::vec4 &plane : this->planes) {
+            __m256 distance {_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(plane.x)), _mm256_set1_ps(plane.w))};
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(y, _mm256_set1_ps(plane.y)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(z, _mm256_set1_ps(plane.z)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+        }
+        const int mask {_mm256_movemask_ps(inside)};
+        for(int lane {0}; lane < 8; lane++) visible[i + lane] = (mask >> lane) & 1;
+        numVisible += static_cast<size_t>(std::popcount(static_cast<unsigned int>(mask)));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    // Four Spheres at a Time
+    for(; i + 4 <= end; i += 4) {
+        const __m128 x {_mm_loadu_ps(centerX + i)}, y {_mm_loadu_ps(centerY + i)}, z {_mm_loadu_ps(centerZ + i)};
+        const __m128 negRadius {_mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radii + i))};
+        __m128 inside {_mm_castsi128_ps(_mm_set1_epi32(-1))};
+        for(const glm::vec4 &plane : this->planes) {
+            __m128 distance {_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_set1_ps(plane.w))};
+            distance = _mm_add_ps(distance, _mm_mul_ps(y, _mm_set1_ps(plane.y)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(z, _mm_set1_ps(plane.z)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+        }
+        const int mask {_mm_movemask_ps(inside)};
+        for(int lane {0}; lane < 4; lane++) visible[i + lane] = (mask >> lane) & 1;
+        numVisible += static_cast<size_t>(std::popcount(static_cast<unsigned int>(mask)));
+    }
+#endif
+
+    // Remaining Spheres
+    for(; i < end; i++) {
+        visible[i] = this->intersects(glm::vec3(centerX[i], centerY[i], centerZ[i]), radii[i]);
+        numVisible += visible[i];
+    }
+    return numVisible;
+}
+
+// Cull a Range of Boxes - Outside When Center Distance Plus The Extents Projected on a Plane's Normal Is Below Zero
+size_t sgl::Frustum::cullAABBs(const AABBArray &aabbs, uint8_t* visible, const size_t &begin, const size_t &end) const {
+    const float* centerX {aabbs.centerX.data()};
+    const float* centerY {aabbs.centerY.data()};
+    const float* centerZ {aabbs.centerZ.data()};
+    const float* extentX {aabbs.extentX.data()};
+    const float* extentY {aabbs.extentY.data()};
+    const float* extentZ {aabbs.extentZ.data()};
+    size_t numVisible {0}, i {begin};
+#if defined(__AVX__)
+    // Eight Boxes at a Time
+    for(; i + 8 <= end; i += 8) {
+        const __m256 x {_mm256_loadu_ps(centerX + i)}, y {_mm256_loadu_ps(centerY + i)}, z {_mm256_loadu_ps(centerZ + i)};
+        const __m256 ex {_mm256_loadu_ps(extentX + i)}, ey {_mm256_loadu_ps(extentY + i)}, ez {_mm256_loadu_ps(extentZ + i)};
+        __m256 inside {_mm256_castsi256_ps(_mm256_set1_epi32(-1))};
+        for(const glm::vec4 &plane : this->planes) {
+            __m256 distance {_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(plane.x)), _mm256_set1_ps(plane.w))};
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(y, _mm256_set1_ps(plane.y)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(z, _mm256_set1_ps(plane.z)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ex, _mm256_set1_ps(std::abs(plane.x))));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ey, _mm256_set1_ps(std::abs(plane.y))));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(ez, _mm256_set1_ps(std::abs(plane.z))));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+        }
+        const int mask {_mm256_movemask_ps(inside)};
+        for(int lane {0}; lane < 8; lane++) visible[i + lane] = (mask >> lane) & 1;
+        numVisible += static_cast<size_t>(std::popcount(static_cast<unsigned int>(mask)));
+    }
+#elif defined(__SSE2__) || defined(_M_X64)
+    // Four Boxes at a Time
+    for(; i + 4 <= end; i += 4) {
+        const __m128 x {_mm_loadu_ps(centerX + i)}, y {_mm_loadu_ps(centerY + i)}, z {_mm_loadu_ps(centerZ + i)};
+        const __m128 ex {_mm_loadu_ps(extentX + i)}, ey {_mm_loadu_ps(extentY + i)}, ez {_mm_loadu_ps(extentZ + i)};
+        __m128 inside {_mm_castsi128_ps(_mm_set1_epi32(-1))};
+        for(const glm::vec4 &plane : this->planes) {
+            __m128 distance {_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(plane.x)), _mm_set1_ps(plane.w))};
+            distance = _mm_add_ps(distance, _mm_mul_ps(y, _mm_set1_ps(plane.y)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(z, _mm_set1_ps(plane.z)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ex, _mm_set1_ps(std::abs(plane.x))));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ey, _mm_set1_ps(std::abs(plane.y))));
+            distance = _mm_add_ps(distance, _mm_mul_ps(ez, _mm_set1_ps(std::abs(plane.z))));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+        }
+        const int mask {_mm_movemask_ps(inside)};
+        for(int lane {0}; lane < 4; lane++) visible[i + lane] = (mask >> lane) & 1;
+        numVisible += static_cast<size_t>(std::popcount(static_cast<unsigned int>(mask)));
+    }
+#endif
+
+    // Remaining Boxes
+    for(; i < end; i++) {
+        const glm::vec3 center {centerX[i], centerY[i], centerZ[i]}, extents {extentX[i], extentY[i], extentZ[i]};
+        visible[i] = this->intersects(AABB {center - extents, center + extents});
+        numVisible += visible[i];
+    }
+    return numVisible;
+}
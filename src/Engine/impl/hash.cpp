@@ -0,0 +1,11 @@
+#include"../Engine.hpp"
+
+// Hash Bytes - 64-Bit FNV-1a, Chain Calls by Passing The Previous Hash as The Seed
+uint64_t sgl::hashBytes(const void* data, const size_t &size, const uint64_t &seed) {
+    uint64_t hash {seed};
+    const uint8_t* bytes {static_cast<const uint8_t*>(data)};
+    for(size_t i {0}; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
@@ -0,0 +1,46 @@
+#include"../Engine.hpp"
+
+// Constructor - Create Stream Vertex Buffer Holding Up to maxInstances Model Matrices
+sgl::InstanceBuffer::InstanceBuffer(const int &maxInstances) {
+    this->maxInstances = maxInstances;
+    this->modelMatrices.reserve(static_cast<size_t>(maxInstances));
+
+    // Create Stream Vertex Buffer
+    sg_buffer_desc bufferDesc {};
+    bufferDesc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    bufferDesc.usage = SG_USAGE_STREAM;
+    bufferDesc.size = static_cast<size_t>(maxInstances) * sizeof(glm::mat4);
+    this->buffer = BufferHandle(sg_make_buffer(&bufferDesc));
+}
+
+// Add Instance For This Frame - Returns False When The Buffer Is Full
+bool sgl::InstanceBuffer::add(const glm::mat4 &modelMatrix) {
+    if(static_cast<int>(this->modelMatrices.size()) >= this->maxInstances) return false;
+    this->modelMatrices.push_back(modelMatrix);
+    return true;
+}
+
+// Upload Instances Added This Frame - Once Per Frame (Sokol Allows One Update Per Buffer Per Frame), Then Add The Next Frame's
+void sgl::InstanceBuffer::upload(void) {
+    this->instanceCount = static_cast<int>(this->modelMatrices.size());
+    if(this->instanceCount > 0) {
+        sg_update_buffer(this->buffer.get(), {this->modelMatrices.data(), this->modelMatrices.size() * sizeof(glm::mat4)});
+    }
+    this->modelMatrices.clear();
+}
+
+// Set Up a Pipeline Desc to Read Model Matrix Columns From This Buffer - Four FLOAT4 Attributes Starting at firstAttr
+void sgl::InstanceBuffer::setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &firstAttr) {
+    // Offsets and Stride Are Explicit - Any Explicit Offset Turns Off Sokol's Automatic Ones For Every Buffer, and sgl::Mesh Sets Them
+    pipelineDesc.layout.buffers[bufferIndex].step_func = SG_VERTEXSTEP_PER_INSTANCE;
+    pipelineDesc.layout.buffers[bufferIndex].stride = sizeof(glm::mat4);
+    for(int column {0}; column < 4; column++) {
+        pipelineDesc.layout.attrs[firstAttr + column].buffer_index = bufferIndex;
+        pipelineDesc.layout.attrs[firstAttr + column].offset = column * static_cast<int>(sizeof(glm::vec4));
+        pipelineDesc.layout.attrs[firstAttr + column].format = SG_VERTEXFORMAT_FLOAT4;
+    }
+}
+
+// Getters
+sg_buffer sgl::InstanceBuffer::getBuffer(void) {return this->buffer.get();}
+int sgl::InstanceBuffer::getInstanceCount(void) {return this->instanceCount;}
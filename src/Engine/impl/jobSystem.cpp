@@ -0,0 +1,175 @@
+#include"../Engine.hpp"
+
+// Job System and Deque Index The Current Thread Works For - Only Set on Worker Threads
+static thread_local sgl::JobSystem* workerJobSystem {nullptr};
+static thread_local unsigned int workerQueueIndex {0};
+
+// Constructor - numThreads Threads Run Jobs, Including The Thread Calling wait (So numThreads - 1 Workers Are Started)
+sgl::JobSystem::JobSystem(const unsigned int &numThreads) {
+    // One Deque Per Thread
+    const unsigned int threadCount {std::max(numThreads, 1u)};
+    for(unsigned int i {0}; i < threadCount; i++) {
+        this->queues.push_back(std::make_unique<Queue>());
+    }
+
+    // Start Worker Threads
+    for(unsigned int i {1}; i < threadCount; i++) {
+        this->workers.emplace_back(&sgl::JobSystem::workerMain, this, i);
+    }
+}
+
+// Destructor - Finish Queued Jobs and Join Worker Threads
+sgl::JobSystem::~JobSystem(void) {
+    // Run Whatever Is Left Here When There Are No Workers
+    Job job;
+    while(this->workers.empty() && this->tryGetJob(job)) this->execute(job);
+
+    // Wake Up and Join Worker Threads
+    {
+        std::lock_guard<std::mutex> lock(this->sleepMutex);
+        this->stopping = true;
+    }
+    this->sleepCondition.notify_all();
+    for(std::thread &worker : this->workers) {
+        worker.join();
+    }
+}
+
+// Run Job - Counted Against counter Until It Finishes When One Is Given
+void sgl::JobSystem::run(std::function<void(void)> job, JobCounter* counter) {
+    if(counter) counter->count.fetch_add(1, std::memory_order_relaxed);
+    this->push({std::move(job), counter});
+}
+
+// Run Job Once Every Job Counted Against dependency Has Finished
+void sgl::JobSystem::runAfter(JobCounter &dependency, std::function<void(void)> job, JobCounter* counter) {
+    // Count The Job Now So Waiting on counter Covers It Before It Is Queued
+    if(counter) counter->count.fetch_add(1, std::memory_order_relaxed);
+
+    // Park The Job on The Dependency - The Job Finishing It Queues It Under The Same Lock
+    {
+        std::lock_guard<std::mutex> lock(dependency.continuationsMutex);
+        if(!dependency.isDone()) {
+            dependency.continuations.emplace_back(std::move(job), counter);
+            return;
+        }
+    }
+
+    // Dependency Already Done
+    this->push({std::move(job), counter});
+}
+
+// Wait For Every Job Counted Against counter - The Waiting Thread Runs Queued Jobs Meanwhile
+void sgl::JobSystem::wait(JobCounter &counter) {
+    Job job;
+    while(!counter.isDone()) {
+        if(this->tryGetJob(job)) {
+            this->execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // The Last Job Releases The Lock After Reaching Zero - Take It So The Counter Can Be Destroyed After Returning
+    std::lock_guard<std::mutex> lock(counter.continuationsMutex);
+}
+
+// Getters
+unsigned int sgl::JobSystem::getThreadCount(void) {return static_cast<unsigned int>(this->queues.size());}
+
+// Worker Thread Main Loop
+void sgl::JobSystem::workerMain(const unsigned int &queueIndex) {
+    workerJobSystem = this;
+    workerQueueIndex = queueIndex;
+    Job job;
+    while(true) {
+        // Run Jobs Until Every Deque Is Empty
+        if(this->tryGetJob(job)) {
+            this->execute(job);
+            continue;
+        }
+
+        // Sleep Until a Job Is Queued or The Job System Stops
+        std::unique_lock<std::mutex> lock(this->sleepMutex);
+        this->sleepCondition.wait(lock, [this](void) {return this->stopping || this->queuedJobs.load() > 0;});
+        if(this->stopping && this->queuedJobs.load() == 0) return;
+    }
+}
+
+// Queue a Job on The Calling Thread's Deque and Wake a Worker
+void sgl::JobSystem::push(Job job) {
+    {
+        Queue &queue {*this->queues[this->getQueueIndex()]};
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(std::move(job));
+    }
+    this->queuedJobs.fetch_add(1);
+
+    // Take The Sleep Lock So a Worker Between Checking queuedJobs and Sleeping Cannot Miss The Notification
+    {
+        std::lock_guard<std::mutex> lock(this->sleepMutex);
+    }
+    this->sleepCondition.notify_one();
+}
+
+// Pop a Job From The Calling Thread's Deque or Steal One - False if Every Deque Is Empty
+bool sgl::JobSystem::tryGetJob(Job &job) {
+    if(this->queuedJobs.load() == 0) return false;
+
+    // Own Deque - Newest Job First, Its Data Is Most Likely Still in Cache
+    const unsigned int ownIndex {this->getQueueIndex()};
+    {
+        Queue &queue {*this->queues[ownIndex]};
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(!queue.jobs.empty()) {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+            this->queuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Steal The Oldest Job From The Other Deques, Starting After Our Own
+    const unsigned int numQueues {static_cast<unsigned int>(this->queues.size())};
+    for(unsigned int i {1}; i < numQueues; i++) {
+        Queue &queue {*this->queues[(ownIndex + i) % numQueues]};
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if(!queue.jobs.empty()) {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+            this->queuedJobs.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Run a Job and Finish It Against Its Counter, Queueing Jobs That Were Waiting on The Counter
+void sgl::JobSystem::execute(Job &job) {
+    // Run Job
+    job.func();
+    job.func = nullptr;
+    JobCounter* counter {job.counter};
+    if(!counter) return;
+
+    // Finish Against Counter - Not The Last Job, The Counter Must Not Be Touched Afterwards
+    int count {counter->count.load(std::memory_order_relaxed)};
+    while(count > 1) {
+        if(counter->count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel)) return;
+    }
+
+    // Last Job - Reach Zero Under The Lock, wait Takes It Before Returning So The Counter Outlives This
+    std::vector<std::pair<std::function<void(void)>, JobCounter*>> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->continuationsMutex);
+        if(counter->count.fetch_sub(1, std::memory_order_acq_rel) == 1) continuations.swap(counter->continuations);
+    }
+    for(std::pair<std::function<void(void)>, JobCounter*> &continuation : continuations) {
+        this->push({std::move(continuation.first), continuation.second});
+    }
+}
+
+// Calling Thread's Deque Index
+unsigned int sgl::JobSystem::getQueueIndex(void) {
+    return workerJobSystem == this ? workerQueueIndex : 0;
+}
@@ -0,0 +1,77 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<limits>
+
+// Objects Per Job When Selecting in Parallel
+static const size_t selectGrainSize {16384};
+
+// Constructor - screenSizes[i] Is The Screen Size Below Which Level i + 1 Replaces Level i (Descending)
+// A Switch Only Happens Once The Size Is hysteresis (a Fraction of The Threshold) Past It
+sgl::LODSelector::LODSelector(const std::vector<float> &screenSizes, const float &hysteresis) : screenSizes {screenSizes}, hysteresis {hysteresis} {
+    // Display Error Message if Thresholds Would Make Levels Unreachable
+    if(!std::is_sorted(this->screenSizes.rbegin(), this->screenSizes.rend())) {
+        std::cerr << "Failed to Use LOD Screen Sizes - They Must Be in Descending Order" << std::endl;
+    }
+    if(this->screenSizes.size() > UINT8_MAX) this->screenSizes.resize(UINT8_MAX);
+}
+
+// Screen Sizes For an LOD Chain - Each Level Is Used While Its Error Projects to Less Than maxScreenError (Fraction of Viewport Height)
+// The Diameter Maps to radius / (distance * tan(fov / 2)) of The Height and an Error e to e / (2 * distance * tan(fov / 2))
+std::vector<float> sgl::LODSelector::makeScreenSizes(const std::vector<MeshLOD> &chain, const float &maxScreenError) {
+    std::vector<float> screenSizes;
+    if(chain.empty()) return screenSizes;
+    const float radius {glm::length(chain[0].mesh.getBounds().getExtents())};
+    for(size_t level {1}; level < chain.size(); level++) {
+        const float threshold {chain[level].error > 0.0f ? 2.0f * maxScreenError * radius / chain[level].error : std::numeric_limits<float>::max()};
+        screenSizes.push_back(std::min(threshold, screenSizes.empty() ? std::numeric_limits<float>::max() : screenSizes.back()));
+    }
+    return screenSizes;
+}
+
+// Screen Size - Bounding Sphere's Projected Diameter as a Fraction of Viewport Height, Using The Camera's Position and FOV
+float sgl::LODSelector::getScreenSize(Camera &camera, const glm::vec3 &center, const float &radius) {
+    const float distance {glm::length(center - camera.getPos())};
+    if(distance <= radius) return std::numeric_limits<float>::max();
+    return radius / (distance * glm::tan(glm::radians(camera.getFOV()) * 0.5f));
+}
+
+// Select Level For One Object From Its Screen Size and Current Level
+int sgl::LODSelector::select(const float &screenSize, const int &currentLevel) const {
+    const int lastLevel {static_cast<int>(this->screenSizes.size())};
+    int level {std::clamp(currentLevel, 0, lastLevel)};
+    while(level < lastLevel && screenSize < this->screenSizes[level] * (1.0f - this->hysteresis)) level++;
+    while(level > 0 && screenSize > this->screenSizes[level - 1] * (1.0f + this->hysteresis)) level--;
+    return level;
+}
+
+// Select Levels For Many Objects - levels Holds Each Object's Current Level and Is Updated in Place (New Objects Start at 0)
+// Split Over a Job System When One Is Given, Returns The Number of Objects That Changed Level
+size_t sgl::LODSelector::select(Camera &camera, const SphereArray &spheres, std::vector<uint8_t> &levels, JobSystem* jobSystem) const {
+    levels.resize(spheres.getCount(), 0);
+    const glm::vec3 cameraPos {camera.getPos()};
+    const float tanHalfFOV {glm::tan(glm::radians(camera.getFOV()) * 0.5f)};
+
+    // Select a Range of Objects - Returns The Changes in The Range
+    const auto selectRange = [&](const size_t &begin, const size_t &end) {
+        size_t changes {0};
+        for(size_t i {begin}; i < end; i++) {
+            const glm::vec3 center {spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]};
+            const float distance {glm::length(center - cameraPos)};
+            const float screenSize {distance > spheres.radii[i] ? spheres.radii[i] / (distance * tanHalfFOV) : std::numeric_limits<float>::max()};
+            const uint8_t level {static_cast<uint8_t>(this->select(screenSize, levels[i]))};
+            changes += level != levels[i];
+            levels[i] = level;
+        }
+        return changes;
+    };
+    if(!jobSystem) return selectRange(0, spheres.getCount());
+    std::atomic<size_t> changes {0};
+    jobSystem->parallelFor(spheres.getCount(), selectGrainSize, [&](const size_t &begin, const size_t &end) {
+        changes.fetch_add(selectRange(begin, end), std::memory_order_relaxed);
+    });
+    return changes.load();
+}
+
+// Getters
+int sgl::LODSelector::getLevelCount(void) const {return static_cast<int>(this->screenSizes.size()) + 1;}
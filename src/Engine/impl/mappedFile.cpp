@@ -0,0 +1,42 @@
+#include"../Engine.hpp"
+
+// POSIX Headers
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+
+// Constructor - Map File Into Memory
+sgl::MappedFile::MappedFile(const std::string &filePath) {
+    // Open File
+    int fd {open(filePath.c_str(), O_RDONLY)};
+    if(fd < 0) {
+        std::cerr << "Failed to Open File: " << filePath << std::endl;
+        return;
+    }
+
+    // Map The Whole File - Pages Are Read In Up Front So The Mapping Can Be Handed to Another Thread Ready to Use
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+        void* mapping {mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0)};
+        if(mapping != MAP_FAILED) {
+            this->data = mapping;
+            this->size = static_cast<size_t>(fileStat.st_size);
+        } else {
+            std::cerr << "Failed to Map File: " << filePath << std::endl;
+        }
+    }
+
+    // The Mapping Stays Valid After The File Is Closed
+    close(fd);
+}
+
+// Destructor - Unmap File
+sgl::MappedFile::~MappedFile(void) {
+    if(this->data) munmap(this->data, this->size);
+}
+
+// Getters
+bool sgl::MappedFile::isOpen(void) {return this->data != nullptr;}
+const uint8_t* sgl::MappedFile::getData(void) {return static_cast<const uint8_t*>(this->data);}
+size_t sgl::MappedFile::getSize(void) {return this->size;}
@@ -0,0 +1,110 @@
+#include"../Engine.hpp"
+
+// Constructor - pipelineDesc Holds The Vertex Layout and Render State, The Registry Fills In The Permutation's Shader
+sgl::Material::Material(ShaderRegistry &shaderRegistry, const uint32_t &permutationMask, const sg_pipeline_desc &pipelineDesc, const uint32_t &pass) {
+    this->pipeline = shaderRegistry.getPipeline(permutationMask, pipelineDesc);
+    this->pass = pass;
+}
+
+// Destructor - Remove The Material's Bindings From Its Render Queue
+sgl::Material::~Material(void) {
+    if(!this->renderQueue) return;
+    for(const auto &[meshBuffers, bindingsId] : this->bindingsIds) {
+        this->renderQueue->removeBindings(bindingsId);
+    }
+}
+
+// Move Constructor - The Moved From Material No Longer Owns Any Bindings
+sgl::Material::Material(Material &&other) noexcept {
+    this->pipeline = other.pipeline;
+    this->pass = other.pass;
+    this->textures = other.textures;
+    this->uniformsStage = other.uniformsStage;
+    this->uniformsSlot = other.uniformsSlot;
+    this->uniformData = std::move(other.uniformData);
+    this->renderQueue = std::exchange(other.renderQueue, nullptr);
+    this->bindingsIds = std::move(other.bindingsIds);
+    other.bindingsIds.clear();
+    this->lastMeshBuffers = other.lastMeshBuffers;
+    this->lastBindingsId = std::exchange(other.lastBindingsId, UINT32_MAX);
+    this->uniformsId = other.uniformsId;
+    this->uniformsFlush = other.uniformsFlush;
+}
+
+// Set Texture and Sampler - Cached Bindings Are Rebuilt Under Their Existing IDs, So Packets Keep Batching
+void sgl::Material::setTexture(const sg_shader_stage &stage, const int &imageSlot, const sg_image &image, const int &samplerSlot, const sg_sampler &sampler) {
+    sg_stage_bindings &stageBindings {stage == SG_SHADERSTAGE_VS ? this->textures.vs : this->textures.fs};
+    stageBindings.images[imageSlot] = image;
+    stageBindings.samplers[samplerSlot] = sampler;
+
+    // Overwrite Bindings Already Registered - Dropping Their IDs Would Leave Them Orphaned in The Render Queue
+    for(const auto &[meshBuffers, bindingsId] : this->bindingsIds) {
+        this->renderQueue->setBindings(bindingsId, this->makeBindings(meshBuffers));
+    }
+}
+
+// Set Default Uniforms - The Material's Uniform Block, Copied and Applied Once Per Batch
+void sgl::Material::setUniforms(const sg_shader_stage &stage, const int &slot, const sg_range &data) {
+    const uint8_t* uniforms {static_cast<const uint8_t*>(data.ptr)};
+    this->uniformsStage = stage;
+    this->uniformsSlot = slot;
+    this->uniformData.assign(uniforms, uniforms + data.size);
+    this->uniformsFlush = UINT64_MAX;
+}
+
+// Submit Draw Packet - Fills In Pipeline, Bindings (meshBindings' Buffers Plus The Material's Textures), Material Uniforms and Sort Key
+void sgl::Material::submit(RenderQueue &renderQueue, DrawPacket packet, const sg_bindings &meshBindings, const float &depth, const sg_range &objectUniforms) {
+    // Bindings IDs Belong to One Render Queue
+    if(!this->renderQueue) {
+        this->renderQueue = &renderQueue;
+    } else if(this->renderQueue != &renderQueue) {
+        std::cerr << "Failed to Submit Material: It Is Already Used With Another Render Queue" << std::endl;
+        return;
+    }
+
+    // Bindings For These Mesh Buffers - Built and Registered The First Time They're Drawn With This Material
+    MeshBuffers meshBuffers {};
+    std::memcpy(meshBuffers.vertexBuffers, meshBindings.vertex_buffers, sizeof(meshBuffers.vertexBuffers));
+    std::memcpy(meshBuffers.vertexBufferOffsets, meshBindings.vertex_buffer_offsets, sizeof(meshBuffers.vertexBufferOffsets));
+    meshBuffers.indexBuffer = meshBindings.index_buffer;
+    meshBuffers.indexBufferOffset = meshBindings.index_buffer_offset;
+    if(this->lastBindingsId == UINT32_MAX || std::memcmp(&meshBuffers, &this->lastMeshBuffers, sizeof(meshBuffers)) != 0) {
+        auto bindingsIt {this->bindingsIds.find(meshBuffers)};
+        if(bindingsIt == this->bindingsIds.end()) {
+            bindingsIt = this->bindingsIds.emplace(meshBuffers, renderQueue.addBindings(this->makeBindings(meshBuffers))).first;
+        }
+        this->lastMeshBuffers = meshBuffers;
+        this->lastBindingsId = bindingsIt->second;
+    }
+
+    // Default Uniforms - Added to The Queue Once Per Flush, Every Draw Using The Material References The Same Block
+    if(this->uniformsSlot >= 0 && this->uniformsFlush != renderQueue.getFlushCount()) {
+        this->uniformsId = renderQueue.addUniforms(this->uniformsStage, this->uniformsSlot, {this->uniformData.data(), this->uniformData.size()});
+        this->uniformsFlush = renderQueue.getFlushCount();
+    }
+
+    // Submit - Keyed by Pipeline Then Bindings, So Draws Using The Material and Mesh End Up Next to Each Other
+    packet.pipeline = this->pipeline;
+    packet.bindingsId = this->lastBindingsId;
+    packet.materialUniformsId = this->uniformsSlot >= 0 ? this->uniformsId : RenderQueue::noUniforms;
+    packet.sortKey = RenderQueue::makeSortKey(this->pass, this->pipeline, packet.bindingsId, depth);
+    renderQueue.submit(packet, objectUniforms);
+}
+
+// Getters
+sg_pipeline sgl::Material::getPipeline(void) {return this->pipeline;}
+size_t sgl::Material::getBindingsCount(void) {return this->bindingsIds.size();}
+
+// Mesh Buffers Comparison and Hash - Mesh Buffers Have No Padding, So Their Bytes Identify Them
+bool sgl::Material::MeshBuffers::operator==(const MeshBuffers &other) const {return std::memcmp(this, &other, sizeof(MeshBuffers)) == 0;}
+size_t sgl::Material::MeshBuffersHash::operator()(const MeshBuffers &meshBuffers) const {return static_cast<size_t>(hashBytes(&meshBuffers, sizeof(meshBuffers)));}
+
+// Bindings For Mesh Buffers - The Material's Textures Plus The Buffers
+sg_bindings sgl::Material::makeBindings(const MeshBuffers &meshBuffers) {
+    sg_bindings bindings {this->textures};
+    std::memcpy(bindings.vertex_buffers, meshBuffers.vertexBuffers, sizeof(bindings.vertex_buffers));
+    std::memcpy(bindings.vertex_buffer_offsets, meshBuffers.vertexBufferOffsets, sizeof(bindings.vertex_buffer_offsets));
+    bindings.index_buffer = meshBuffers.indexBuffer;
+    bindings.index_buffer_offset = meshBuffers.indexBufferOffset;
+    return bindings;
+}
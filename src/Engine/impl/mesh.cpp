@@ -0,0 +1,67 @@
+#include"../Engine.hpp"
+
+// Constructor - Map Mesh Blob File and Hand The Mapped Vertex/Index Data to sg_make_buffer, No Copies
+sgl::Mesh::Mesh(const std::string &meshBlobFilePath) {
+    // Map and Validate Mesh Blob - The Mapping Only Has to Outlive sg_make_buffer
+    MappedFile meshBlob(meshBlobFilePath);
+    if(!readMeshBlobHeader(meshBlob, this->header)) {
+        std::cerr << "Failed to Load Mesh Blob File: " << meshBlobFilePath << std::endl;
+        this->header = {};
+        return;
+    }
+    const uint8_t* blobData {meshBlob.getData()};
+
+    // Vertex and Index Buffers
+    sg_buffer_desc vertexBufferDesc {};
+    vertexBufferDesc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    vertexBufferDesc.data = {blobData + this->header.vertexOffset, static_cast<size_t>(this->header.numVertices) * this->header.vertexStride};
+    this->vertexBuffer = BufferHandle(sg_make_buffer(&vertexBufferDesc));
+
+    sg_buffer_desc indexBufferDesc {};
+    indexBufferDesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    const size_t indexSize {this->header.indexType == SG_INDEXTYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t)};
+    indexBufferDesc.data = {blobData + this->header.indexOffset, this->header.numIndices * indexSize};
+    this->indexBuffer = BufferHandle(sg_make_buffer(&indexBufferDesc));
+
+    // Bounds and Submeshes
+    std::memcpy(&this->bounds.min, this->header.boundsMin, sizeof(this->header.boundsMin));
+    std::memcpy(&this->bounds.max, this->header.boundsMax, sizeof(this->header.boundsMax));
+    for(uint32_t i {0}; i < this->header.numSubmeshes; i++) {
+        MeshBlobSubmesh submesh;
+        std::memcpy(&submesh, blobData + this->header.submeshOffset + i * sizeof(MeshBlobSubmesh), sizeof(submesh));
+        Submesh &loadedSubmesh {this->submeshes.emplace_back()};
+        loadedSubmesh.firstIndex = static_cast<int>(submesh.firstIndex);
+        loadedSubmesh.numIndices = static_cast<int>(submesh.numIndices);
+        std::memcpy(&loadedSubmesh.bounds.min, submesh.boundsMin, sizeof(submesh.boundsMin));
+        std::memcpy(&loadedSubmesh.bounds.max, submesh.boundsMax, sizeof(submesh.boundsMax));
+    }
+}
+
+// Set a Pipeline's Vertex Layout For This Mesh in bufferIndex and Its Index Type - Attribute Slots of -1 Are Skipped
+// Offsets and Stride Are Explicit, So Other Buffers in The Pipeline Need Explicit Offsets Too
+void sgl::Mesh::setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &positionAttr, const int &normalAttr, const int &texCoordAttr) const {
+    pipelineDesc.layout.buffers[bufferIndex].stride = static_cast<int>(this->header.vertexStride);
+    const int attrSlots[meshAttrCount] {positionAttr, normalAttr, texCoordAttr};
+    for(int attr {0}; attr < meshAttrCount; attr++) {
+        if(attrSlots[attr] < 0 || this->header.attributes[attr].format == SG_VERTEXFORMAT_INVALID) continue;
+        pipelineDesc.layout.attrs[attrSlots[attr]].buffer_index = bufferIndex;
+        pipelineDesc.layout.attrs[attrSlots[attr]].offset = static_cast<int>(this->header.attributes[attr].offset);
+        pipelineDesc.layout.attrs[attrSlots[attr]].format = static_cast<sg_vertex_format>(this->header.attributes[attr].format);
+    }
+    pipelineDesc.index_type = static_cast<sg_index_type>(this->header.indexType);
+}
+
+// Getters
+bool sgl::Mesh::isLoaded(void) const {return this->header.numVertices > 0;}
+sg_buffer sgl::Mesh::getVertexBuffer(void) const {return this->vertexBuffer.get();}
+sg_buffer sgl::Mesh::getIndexBuffer(void) const {return this->indexBuffer.get();}
+int sgl::Mesh::getNumVertices(void) const {return static_cast<int>(this->header.numVertices);}
+int sgl::Mesh::getNumIndices(void) const {return static_cast<int>(this->header.numIndices);}
+const sgl::AABB &sgl::Mesh::getBounds(void) const {return this->bounds;}
+const std::vector<sgl::Mesh::Submesh> &sgl::Mesh::getSubmeshes(void) const {return this->submeshes;}
+
+// Model Matrix Applied Before The Mesh's Own - Maps Quantized Positions Back Into The Bounds, Identity For Float Positions
+glm::mat4 sgl::Mesh::getPositionTransform(void) const {
+    if(this->header.attributes[meshAttrPosition].format != SG_VERTEXFORMAT_SHORT4N) return glm::mat4(1.0f);
+    return glm::scale(glm::translate(glm::mat4(1.0f), this->bounds.getCenter()), this->bounds.getExtents());
+}
@@ -0,0 +1,196 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<fstream>
+#include<limits>
+
+// Sections Are Aligned to This Many Bytes Within The Blob
+static const uint64_t sectionAlignment {16};
+
+// Round Up to The Section Alignment
+static uint64_t alignSection(const uint64_t &offset) {
+    return (offset + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+}
+
+// Check a Section of count * stride Bytes at offset Lies Within a File - Written So It Cannot Wrap Around on Overflow
+// count and stride Are 32-Bit, So Their Product Always Fits in 64 Bits
+static bool sectionFits(const uint64_t &offset, const uint64_t &count, const uint64_t &stride, const uint64_t &fileSize) {
+    const uint64_t sectionSize {count * stride};
+    return sectionSize <= fileSize && offset <= fileSize - sectionSize;
+}
+
+// Size of a Vertex Attribute Format in Bytes, 0 For Formats Mesh Blobs Don't Use
+static uint32_t getVertexFormatSize(const sg_vertex_format &format) {
+    switch(format) {
+        case SG_VERTEXFORMAT_FLOAT: return 4;
+        case SG_VERTEXFORMAT_FLOAT2: return 8;
+        case SG_VERTEXFORMAT_FLOAT3: return 12;
+        case SG_VERTEXFORMAT_FLOAT4: return 16;
+        case SG_VERTEXFORMAT_BYTE4N: case SG_VERTEXFORMAT_UBYTE4N: return 4;
+        case SG_VERTEXFORMAT_SHORT2N: case SG_VERTEXFORMAT_USHORT2N: return 4;
+        case SG_VERTEXFORMAT_SHORT4N: case SG_VERTEXFORMAT_USHORT4N: return 8;
+        case SG_VERTEXFORMAT_UINT10_N2: return 4;
+        case SG_VERTEXFORMAT_HALF2: return 4;
+        case SG_VERTEXFORMAT_HALF4: return 8;
+        default: return 0;
+    }
+}
+
+// Write Mesh Blob - Position, Normal and TexCoord (When Present) Interleaved, 16-Bit Indices When Every Vertex Fits
+// Floats Unless quantize Is Set - Then SHORT4N Positions Within The Bounds, BYTE4N Normals and USHORT2N TexCoords When They Lie in [0, 1]
+bool sgl::writeMeshBlob(const MeshData &mesh, const std::string &meshBlobFilePath, const bool &quantize) {
+    // Reject Meshes The Reader Would Reject - Empty, or Indices and Submeshes Out of Range
+    if(mesh.positions.empty() || mesh.indices.empty()) {
+        std::cerr << "Failed to Write Mesh Blob, Mesh Has No Vertices or Indices: " << meshBlobFilePath << std::endl;
+        return false;
+    }
+    const size_t numVertices {mesh.positions.size()};
+    if(std::any_of(mesh.indices.begin(), mesh.indices.end(), [&](const uint32_t &index) {return index >= numVertices;})) {
+        std::cerr << "Failed to Write Mesh Blob, Index Out of Range: " << meshBlobFilePath << std::endl;
+        return false;
+    }
+    for(const MeshSubmesh &submesh : mesh.submeshes) {
+        if(static_cast<uint64_t>(submesh.firstIndex) + submesh.numIndices > mesh.indices.size()) {
+            std::cerr << "Failed to Write Mesh Blob, Submesh Out of Range: " << meshBlobFilePath << std::endl;
+            return false;
+        }
+    }
+
+    const bool hasNormals {!mesh.normals.empty()}, hasTexCoords {!mesh.texCoords.empty()};
+    const bool shortIndices {mesh.positions.size() <= 65536};
+    const bool unitTexCoords {std::all_of(mesh.texCoords.begin(), mesh.texCoords.end(), [](const glm::vec2 &texCoord) {
+        return texCoord.x >= 0.0f && texCoord.x <= 1.0f && texCoord.y >= 0.0f && texCoord.y <= 1.0f;
+    })};
+
+    // Vertex Layout - Attributes Packed in Slot Order
+    MeshBlobHeader header {};
+    std::memcpy(header.magic, meshBlobMagic, sizeof(header.magic));
+    header.version = meshBlobVersion;
+    header.numVertices = static_cast<uint32_t>(mesh.positions.size());
+    header.numIndices = static_cast<uint32_t>(mesh.indices.size());
+    header.indexType = shortIndices ? SG_INDEXTYPE_UINT16 : SG_INDEXTYPE_UINT32;
+    const sg_vertex_format attributeFormats[meshAttrCount] {
+        quantize ? SG_VERTEXFORMAT_SHORT4N : SG_VERTEXFORMAT_FLOAT3,
+        hasNormals ? (quantize ? SG_VERTEXFORMAT_BYTE4N : SG_VERTEXFORMAT_FLOAT3) : SG_VERTEXFORMAT_INVALID,
+        hasTexCoords ? (quantize && unitTexCoords ? SG_VERTEXFORMAT_USHORT2N : SG_VERTEXFORMAT_FLOAT2) : SG_VERTEXFORMAT_INVALID,
+    };
+    for(int attr {0}; attr < meshAttrCount; attr++) {
+        if(attributeFormats[attr] == SG_VERTEXFORMAT_INVALID) continue;
+        header.attributes[attr] = {attributeFormats[attr], header.vertexStride};
+        header.vertexStride += getVertexFormatSize(attributeFormats[attr]);
+    }
+
+    // Bounds of The Whole Mesh and Each Submesh - No Submeshes Means One Covering Every Index
+    const AABB bounds {mesh.getBounds()};
+    std::memcpy(header.boundsMin, &bounds.min, sizeof(header.boundsMin));
+    std::memcpy(header.boundsMax, &bounds.max, sizeof(header.boundsMax));
+    std::vector<MeshSubmesh> submeshRanges {mesh.submeshes};
+    if(submeshRanges.empty()) submeshRanges.push_back({0, header.numIndices});
+    std::vector<MeshBlobSubmesh> submeshes;
+    for(const MeshSubmesh &range : submeshRanges) {
+        AABB submeshBounds;
+        for(uint32_t i {range.firstIndex}; i < range.firstIndex + range.numIndices; i++) {
+            const glm::vec3 &position {mesh.positions[mesh.indices[i]]};
+            if(i == range.firstIndex) submeshBounds = {position, position};
+            submeshBounds.min = glm::min(submeshBounds.min, position);
+            submeshBounds.max = glm::max(submeshBounds.max, position);
+        }
+        MeshBlobSubmesh &submesh {submeshes.emplace_back()};
+        submesh.firstIndex = range.firstIndex;
+        submesh.numIndices = range.numIndices;
+        std::memcpy(submesh.boundsMin, &submeshBounds.min, sizeof(submesh.boundsMin));
+        std::memcpy(submesh.boundsMax, &submeshBounds.max, sizeof(submesh.boundsMax));
+    }
+    header.numSubmeshes = static_cast<uint32_t>(submeshes.size());
+
+    // Interleave Vertices - Quantized Positions Are Relative to The Bounds, Whose Center and Half Extents Mesh::getPositionTransform Restores
+    const glm::vec3 boundsCenter {bounds.getCenter()}, boundsExtents {bounds.getExtents()};
+    const glm::vec3 positionScale {glm::vec3(32767.0f) / glm::max(boundsExtents, glm::vec3(std::numeric_limits<float>::min()))};
+    std::vector<uint8_t> vertexData(static_cast<size_t>(header.numVertices) * header.vertexStride);
+    for(size_t vertex {0}; vertex < mesh.positions.size(); vertex++) {
+        uint8_t* vertexStart {vertexData.data() + vertex * header.vertexStride};
+        if(attributeFormats[meshAttrPosition] == SG_VERTEXFORMAT_SHORT4N) {
+            const glm::vec3 quantized {glm::round(glm::clamp((mesh.positions[vertex] - boundsCenter) * positionScale, -32767.0f, 32767.0f))};
+            const int16_t position[4] {static_cast<int16_t>(quantized.x), static_cast<int16_t>(quantized.y), static_cast<int16_t>(quantized.z), 0};
+            std::memcpy(vertexStart + header.attributes[meshAttrPosition].offset, position, sizeof(position));
+        } else {
+            std::memcpy(vertexStart + header.attributes[meshAttrPosition].offset, &mesh.positions[vertex], sizeof(glm::vec3));
+        }
+        if(attributeFormats[meshAttrNormal] == SG_VERTEXFORMAT_BYTE4N) {
+            const glm::vec3 quantized {glm::round(glm::clamp(mesh.normals[vertex], -1.0f, 1.0f) * 127.0f)};
+            const int8_t normal[4] {static_cast<int8_t>(quantized.x), static_cast<int8_t>(quantized.y), static_cast<int8_t>(quantized.z), 0};
+            std::memcpy(vertexStart + header.attributes[meshAttrNormal].offset, normal, sizeof(normal));
+        } else if(hasNormals) {
+            std::memcpy(vertexStart + header.attributes[meshAttrNormal].offset, &mesh.normals[vertex], sizeof(glm::vec3));
+        }
+        if(attributeFormats[meshAttrTexCoord] == SG_VERTEXFORMAT_USHORT2N) {
+            const glm::vec2 quantized {glm::round(mesh.texCoords[vertex] * 65535.0f)};
+            const uint16_t texCoord[2] {static_cast<uint16_t>(quantized.x), static_cast<uint16_t>(quantized.y)};
+            std::memcpy(vertexStart + header.attributes[meshAttrTexCoord].offset, texCoord, sizeof(texCoord));
+        } else if(hasTexCoords) {
+            std::memcpy(vertexStart + header.attributes[meshAttrTexCoord].offset, &mesh.texCoords[vertex], sizeof(glm::vec2));
+        }
+    }
+
+    // Narrow Indices
+    std::vector<uint16_t> shortIndexData;
+    if(shortIndices) shortIndexData.assign(mesh.indices.begin(), mesh.indices.end());
+    const char* indexData {shortIndices ? reinterpret_cast<const char*>(shortIndexData.data()) : reinterpret_cast<const char*>(mesh.indices.data())};
+    const size_t indexDataSize {mesh.indices.size() * (shortIndices ? sizeof(uint16_t) : sizeof(uint32_t))};
+
+    // Section Offsets - Submesh Table, Vertex Data Then Index Data
+    header.submeshOffset = alignSection(sizeof(header));
+    header.vertexOffset = alignSection(header.submeshOffset + submeshes.size() * sizeof(MeshBlobSubmesh));
+    header.indexOffset = alignSection(header.vertexOffset + vertexData.size());
+
+    // Write Mesh Blob File
+    std::ofstream meshBlobFile(meshBlobFilePath, std::ios::binary);
+    if(!meshBlobFile) {
+        std::cerr << "Failed to Open Mesh Blob File: " << meshBlobFilePath << std::endl;
+        return false;
+    }
+    meshBlobFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    meshBlobFile.seekp(static_cast<std::streamoff>(header.submeshOffset));
+    meshBlobFile.write(reinterpret_cast<const char*>(submeshes.data()), static_cast<std::streamsize>(submeshes.size() * sizeof(MeshBlobSubmesh)));
+    meshBlobFile.seekp(static_cast<std::streamoff>(header.vertexOffset));
+    meshBlobFile.write(reinterpret_cast<const char*>(vertexData.data()), static_cast<std::streamsize>(vertexData.size()));
+    meshBlobFile.seekp(static_cast<std::streamoff>(header.indexOffset));
+    meshBlobFile.write(indexData, static_cast<std::streamsize>(indexDataSize));
+    if(!meshBlobFile) {
+        std::cerr << "Failed to Write Mesh Blob File: " << meshBlobFilePath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+// Validate a Mapped Mesh Blob and Copy Its Header - False if The Blob Is Invalid
+bool sgl::readMeshBlobHeader(MappedFile &meshBlob, MeshBlobHeader &header) {
+    // Header
+    if(!meshBlob.isOpen() || meshBlob.getSize() < sizeof(MeshBlobHeader)) return false;
+    std::memcpy(&header, meshBlob.getData(), sizeof(header));
+    if(std::memcmp(header.magic, meshBlobMagic, sizeof(header.magic)) != 0 || header.version != meshBlobVersion) return false;
+    if(header.indexType != SG_INDEXTYPE_UINT16 && header.indexType != SG_INDEXTYPE_UINT32) return false;
+    if(header.numVertices == 0 || header.numIndices == 0) return false;
+
+    // Vertex Layout - Every Used Attribute Fits in The Stride (Checked So It Cannot Wrap Around), Positions Are Required
+    if(header.vertexStride == 0 || header.attributes[meshAttrPosition].format == SG_VERTEXFORMAT_INVALID) return false;
+    for(const MeshBlobAttribute &attribute : header.attributes) {
+        if(attribute.format == SG_VERTEXFORMAT_INVALID) continue;
+        const uint32_t formatSize {getVertexFormatSize(static_cast<sg_vertex_format>(attribute.format))};
+        if(formatSize == 0 || formatSize > header.vertexStride || attribute.offset > header.vertexStride - formatSize) return false;
+    }
+
+    // Sections Lie Within The File
+    const uint64_t indexSize {header.indexType == SG_INDEXTYPE_UINT16 ? sizeof(uint16_t) : sizeof(uint32_t)};
+    if(!sectionFits(header.submeshOffset, header.numSubmeshes, sizeof(MeshBlobSubmesh), meshBlob.getSize())) return false;
+    if(!sectionFits(header.vertexOffset, header.numVertices, header.vertexStride, meshBlob.getSize())) return false;
+    if(!sectionFits(header.indexOffset, header.numIndices, indexSize, meshBlob.getSize())) return false;
+
+    // Submeshes Lie Within The Indices
+    for(uint32_t i {0}; i < header.numSubmeshes; i++) {
+        MeshBlobSubmesh submesh;
+        std::memcpy(&submesh, meshBlob.getData() + header.submeshOffset + i * sizeof(MeshBlobSubmesh), sizeof(submesh));
+        if(static_cast<uint64_t>(submesh.firstIndex) + submesh.numIndices > header.numIndices) return false;
+    }
+    return true;
+}
@@ -0,0 +1,14 @@
+#include"../Engine.hpp"
+
+// Getters
+size_t sgl::MeshData::getVertexCount(void) const {return this->positions.size();}
+size_t sgl::MeshData::getTriangleCount(void) const {return this->indices.size() / 3;}
+sgl::AABB sgl::MeshData::getBounds(void) const {
+    if(this->positions.empty()) return {};
+    AABB bounds {this->positions[0], this->positions[0]};
+    for(const glm::vec3 &position : this->positions) {
+        bounds.min = glm::min(bounds.min, position);
+        bounds.max = glm::max(bounds.max, position);
+    }
+    return bounds;
+}
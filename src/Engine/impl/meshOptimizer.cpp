@@ -0,0 +1,288 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<numeric>
+#include<limits>
+
+// Forsyth Vertex Cache Model - Simulated LRU Cache Size and Score Weights From Tom Forsyth's Linear-Speed Vertex Cache Optimisation
+static const int forsythCacheSize {32};
+static const float forsythLastTriangleScore {0.75f}, forsythCacheDecayPower {1.5f};
+static const float forsythValenceBoostScale {2.0f}, forsythValenceBoostPower {0.5f};
+
+// FIFO Cache Size Overdraw Clustering Simulates - Matches The Default getACMR Cache
+static const int overdrawCacheSize {16};
+
+// No Triangle Chosen Yet
+static const uint32_t invalidTriangle {std::numeric_limits<uint32_t>::max()};
+
+// Submesh Ranges - One Covering Every Index When The Mesh Has None
+static std::vector<sgl::MeshSubmesh> getSubmeshRanges(const sgl::MeshData &mesh) {
+    if(!mesh.submeshes.empty()) return mesh.submeshes;
+    return {{0, static_cast<uint32_t>(mesh.indices.size())}};
+}
+
+// Forsyth Score Tables - Cache Position Scores and Valence Boosts For Vertices With Few Triangles Left, Built Once
+static const int forsythValenceTableSize {64};
+struct ForsythScoreTables {
+    float cache[forsythCacheSize], valence[forsythValenceTableSize];
+    ForsythScoreTables(void) {
+        // The Last Triangle's Vertices Get a Fixed Score So The Next Triangle Is Not Always Its Neighbour Over The Newest Edge
+        for(int position {0}; position < forsythCacheSize; position++) {
+            this->cache[position] = position < 3 ? forsythLastTriangleScore : std::pow(1.0f - static_cast<float>(position - 3) / (forsythCacheSize - 3), forsythCacheDecayPower);
+        }
+        this->valence[0] = 0.0f;
+        for(int remainingTriangles {1}; remainingTriangles < forsythValenceTableSize; remainingTriangles++) {
+            this->valence[remainingTriangles] = forsythValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -forsythValenceBoostPower);
+        }
+    }
+};
+static const ForsythScoreTables forsythScoreTables;
+
+// Forsyth Vertex Score - Recently Used Vertices and Vertices With Few Triangles Left Score Higher, Finished Ones Score -1
+static float getForsythScore(const int &cachePosition, const uint32_t &remainingTriangles) {
+    if(remainingTriangles == 0) return -1.0f;
+    const float cacheScore {cachePosition >= 0 ? forsythScoreTables.cache[cachePosition] : 0.0f};
+    if(remainingTriangles < forsythValenceTableSize) return cacheScore + forsythScoreTables.valence[remainingTriangles];
+    return cacheScore + forsythValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -forsythValenceBoostPower);
+}
+
+// Reorder One Submesh's Triangles For The Vertex Cache - Greedily Emit The Best Scoring Triangle Touching The Simulated Cache
+static void optimizeRangeVertexCache(uint32_t* indices, const size_t &numTriangles, const size_t &numVertices) {
+    // Live Triangles Using Each Vertex - The First remaining[v] Entries From adjacencyOffsets[v] Are Not Yet Emitted
+    std::vector<uint32_t> remaining(numVertices, 0), adjacencyOffsets(numVertices + 1, 0);
+    for(size_t i {0}; i < numTriangles * 3; i++) {
+        remaining[indices[i]]++;
+    }
+    std::inclusive_scan(remaining.begin(), remaining.end(), adjacencyOffsets.begin() + 1);
+    std::vector<uint32_t> adjacency(numTriangles * 3), adjacencyFill(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+    for(size_t i {0}; i < numTriangles * 3; i++) {
+        adjacency[adjacencyFill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+
+    // Initial Scores - Nothing Is Cached Yet
+    std::vector<int> cachePositions(numVertices, -1);
+    std::vector<float> vertexScores(numVertices), triangleScores(numTriangles, 0.0f);
+    for(size_t vertex {0}; vertex < numVertices; vertex++) {
+        vertexScores[vertex] = getForsythScore(-1, remaining[vertex]);
+    }
+    uint32_t bestTriangle {0};
+    for(size_t triangle {0}; triangle < numTriangles; triangle++) {
+        for(size_t corner {0}; corner < 3; corner++) {
+            triangleScores[triangle] += vertexScores[indices[triangle * 3 + corner]];
+        }
+        if(triangleScores[triangle] > triangleScores[bestTriangle]) bestTriangle = static_cast<uint32_t>(triangle);
+    }
+
+    // Emit Triangles - When No Cached Vertex Has Triangles Left, Restart at The First Triangle Not Yet Emitted
+    std::vector<uint8_t> emitted(numTriangles, 0);
+    std::vector<uint32_t> output, cache, newCache;
+    output.reserve(numTriangles * 3);
+    size_t nextUnemitted {0};
+    while(output.size() < numTriangles * 3) {
+        if(bestTriangle == invalidTriangle) {
+            while(emitted[nextUnemitted]) nextUnemitted++;
+            bestTriangle = static_cast<uint32_t>(nextUnemitted);
+        }
+
+        // Emit Best Triangle and Remove It From Its Vertices' Live Triangles
+        emitted[bestTriangle] = 1;
+        newCache.clear();
+        for(size_t corner {0}; corner < 3; corner++) {
+            const uint32_t vertex {indices[bestTriangle * 3 + corner]};
+            output.push_back(vertex);
+            uint32_t* liveTriangles {adjacency.data() + adjacencyOffsets[vertex]};
+            uint32_t* liveTriangle {std::find(liveTriangles, liveTriangles + remaining[vertex], bestTriangle)};
+            if(liveTriangle != liveTriangles + remaining[vertex]) {
+                *liveTriangle = liveTriangles[--remaining[vertex]];
+            }
+            if(std::find(newCache.begin(), newCache.end(), vertex) == newCache.end()) newCache.push_back(vertex);
+        }
+
+        // Move The Triangle's Vertices to The Front of The Cache, Vertices Pushed Past The End Are Evicted
+        const size_t triangleVertices {newCache.size()};
+        for(const uint32_t &vertex : cache) {
+            if(std::find(newCache.begin(), newCache.begin() + triangleVertices, vertex) == newCache.begin() + triangleVertices) newCache.push_back(vertex);
+        }
+        for(size_t i {0}; i < newCache.size(); i++) {
+            cachePositions[newCache[i]] = i < static_cast<size_t>(forsythCacheSize) ? static_cast<int>(i) : -1;
+        }
+
+        // Rescore Every Vertex Whose Cache Position Changed and Pass The Change On to Its Live Triangles
+        for(const uint32_t &vertex : newCache) {
+            const float vertexScore {getForsythScore(cachePositions[vertex], remaining[vertex])};
+            const float scoreChange {vertexScore - vertexScores[vertex]};
+            vertexScores[vertex] = vertexScore;
+            for(uint32_t i {adjacencyOffsets[vertex]}; i < adjacencyOffsets[vertex] + remaining[vertex]; i++) {
+                triangleScores[adjacency[i]] += scoreChange;
+            }
+        }
+
+        // Next Triangle - Best Scoring Live Triangle of a Cached Vertex
+        bestTriangle = invalidTriangle;
+        float bestScore {-std::numeric_limits<float>::max()};
+        newCache.resize(std::min(newCache.size(), static_cast<size_t>(forsythCacheSize)));
+        for(const uint32_t &vertex : newCache) {
+            for(uint32_t i {adjacencyOffsets[vertex]}; i < adjacencyOffsets[vertex] + remaining[vertex]; i++) {
+                if(triangleScores[adjacency[i]] > bestScore) {
+                    bestScore = triangleScores[adjacency[i]];
+                    bestTriangle = adjacency[i];
+                }
+            }
+        }
+        std::swap(cache, newCache);
+    }
+    std::copy(output.begin(), output.end(), indices);
+}
+
+// Vertex Cache - Forsyth's Linear-Speed Reordering of Each Submesh's Triangles So Shared Vertices Stay in The Post-Transform Cache
+void sgl::optimizeVertexCache(MeshData &mesh) {
+    for(const MeshSubmesh &submesh : getSubmeshRanges(mesh)) {
+        optimizeRangeVertexCache(mesh.indices.data() + submesh.firstIndex, submesh.numIndices / 3, mesh.positions.size());
+    }
+}
+
+// Overdraw - Split Each Submesh's Cache-Ordered Triangles Into Clusters, Outward-Facing Clusters First
+// A Cluster's Cache Miss Ratio May Grow to threshold Times That of The Cache-Ordered Triangles
+void sgl::optimizeOverdraw(MeshData &mesh, const float &threshold) {
+    // Simulated FIFO Cache - A Vertex Hits if Fewer Than overdrawCacheSize Vertices Were Loaded Since It Was, Moving cacheTime On Flushes It
+    std::vector<uint32_t> cacheTimes(mesh.positions.size(), 0);
+    uint32_t cacheTime {overdrawCacheSize + 1};
+    auto getTriangleMisses {[&](const uint32_t* triangle) {
+        int misses {0};
+        for(int corner {0}; corner < 3; corner++) {
+            if(cacheTime - cacheTimes[triangle[corner]] > overdrawCacheSize) {
+                cacheTimes[triangle[corner]] = cacheTime++;
+                misses++;
+            }
+        }
+        return misses;
+    }};
+
+    std::vector<uint32_t> clusterStarts, sortedClusters, sortedIndices;
+    std::vector<float> clusterKeys;
+    for(const MeshSubmesh &submesh : getSubmeshRanges(mesh)) {
+        uint32_t* indices {mesh.indices.data() + submesh.firstIndex};
+        const uint32_t numTriangles {submesh.numIndices / 3};
+        if(numTriangles == 0) continue;
+
+        // Hard Boundaries - Triangles Missing on Every Vertex, Where The Cache Order Already Starts Afresh
+        std::vector<uint32_t> hardStarts, hardMisses;
+        cacheTime += overdrawCacheSize + 1;
+        for(uint32_t triangle {0}; triangle < numTriangles; triangle++) {
+            const int misses {getTriangleMisses(indices + triangle * 3)};
+            if(triangle == 0 || misses == 3) {
+                hardStarts.push_back(triangle);
+                hardMisses.push_back(0);
+            }
+            hardMisses.back() += static_cast<uint32_t>(misses);
+        }
+        hardStarts.push_back(numTriangles);
+
+        // Soft Boundaries - Split a Hard Cluster Once Its Running Miss Ratio, Starting Cold, Is Within threshold of The Hard Cluster's
+        clusterStarts.clear();
+        for(size_t hard {0}; hard + 1 < hardStarts.size(); hard++) {
+            const uint32_t hardEnd {hardStarts[hard + 1]};
+            const float missLimit {threshold * static_cast<float>(hardMisses[hard]) / static_cast<float>(hardEnd - hardStarts[hard])};
+            uint32_t clusterStart {hardStarts[hard]}, clusterMisses {0};
+            cacheTime += overdrawCacheSize + 1;
+            clusterStarts.push_back(clusterStart);
+            for(uint32_t triangle {clusterStart}; triangle + 1 < hardEnd; triangle++) {
+                clusterMisses += static_cast<uint32_t>(getTriangleMisses(indices + triangle * 3));
+                if(static_cast<float>(clusterMisses) <= missLimit * static_cast<float>(triangle - clusterStart + 1)) {
+                    clusterStart = triangle + 1;
+                    clusterMisses = 0;
+                    cacheTime += overdrawCacheSize + 1;
+                    clusterStarts.push_back(clusterStart);
+                }
+            }
+        }
+        clusterStarts.push_back(numTriangles);
+
+        // Area-Weighted Centroid and Normal of Each Cluster and of The Whole Submesh
+        const size_t numClusters {clusterStarts.size() - 1};
+        std::vector<glm::vec3> clusterCentroids(numClusters, glm::vec3(0.0f)), clusterNormals(numClusters, glm::vec3(0.0f));
+        glm::vec3 submeshCentroid {0.0f};
+        float submeshArea {0.0f};
+        for(size_t cluster {0}; cluster < numClusters; cluster++) {
+            float clusterArea {0.0f};
+            for(uint32_t triangle {clusterStarts[cluster]}; triangle < clusterStarts[cluster + 1]; triangle++) {
+                const glm::vec3 &p0 {mesh.positions[indices[triangle * 3]]}, &p1 {mesh.positions[indices[triangle * 3 + 1]]}, &p2 {mesh.positions[indices[triangle * 3 + 2]]};
+                const glm::vec3 areaNormal {glm::cross(p1 - p0, p2 - p0)};
+                const float area {glm::length(areaNormal)};
+                clusterCentroids[cluster] += (p0 + p1 + p2) * (area / 3.0f);
+                clusterNormals[cluster] += areaNormal;
+                clusterArea += area;
+            }
+            submeshCentroid += clusterCentroids[cluster];
+            submeshArea += clusterArea;
+            clusterCentroids[cluster] = clusterArea > 0.0f ? clusterCentroids[cluster] / clusterArea : mesh.positions[indices[clusterStarts[cluster] * 3]];
+        }
+        if(submeshArea > 0.0f) submeshCentroid /= submeshArea;
+
+        // Sort Clusters Facing Away From The Centroid First - They Are The Likeliest to Occlude The Rest
+        clusterKeys.resize(numClusters);
+        for(size_t cluster {0}; cluster < numClusters; cluster++) {
+            const float normalLength {glm::length(clusterNormals[cluster])};
+            clusterKeys[cluster] = normalLength > 0.0f ? glm::dot(clusterCentroids[cluster] - submeshCentroid, clusterNormals[cluster] / normalLength) : 0.0f;
+        }
+        sortedClusters.resize(numClusters);
+        std::iota(sortedClusters.begin(), sortedClusters.end(), 0);
+        std::stable_sort(sortedClusters.begin(), sortedClusters.end(), [&](const uint32_t &a, const uint32_t &b) {return clusterKeys[a] > clusterKeys[b];});
+
+        // Rewrite The Submesh's Indices Cluster by Cluster
+        sortedIndices.clear();
+        for(const uint32_t &cluster : sortedClusters) {
+            sortedIndices.insert(sortedIndices.end(), indices + clusterStarts[cluster] * 3, indices + clusterStarts[cluster + 1] * 3);
+        }
+        std::copy(sortedIndices.begin(), sortedIndices.end(), indices);
+    }
+}
+
+// Fetch Vertex - Every Attribute of a Vertex, Vertices Only Merge When All Match Bit For Bit
+struct FetchVertex {
+    glm::vec3 position, normal;
+    glm::vec2 texCoord;
+    bool operator==(const FetchVertex &other) const {return std::memcmp(this, &other, sizeof(FetchVertex)) == 0;}
+};
+struct FetchVertexHash {
+    size_t operator()(const FetchVertex &vertex) const {return static_cast<size_t>(sgl::hashBytes(&vertex, sizeof(vertex)));}
+};
+
+// Vertex Fetch - Merge Identical Vertices, Drop Unused Ones and Store Vertices in The Order The Indices First Use Them
+void sgl::optimizeVertexFetch(MeshData &mesh) {
+    const bool hasNormals {!mesh.normals.empty()}, hasTexCoords {!mesh.texCoords.empty()};
+    std::unordered_map<FetchVertex, uint32_t, FetchVertexHash> uniqueVertices;
+    std::vector<uint32_t> remap(mesh.positions.size(), std::numeric_limits<uint32_t>::max());
+    MeshData fetchOrdered;
+    for(uint32_t &index : mesh.indices) {
+        // First Use of This Vertex - Map It to an Identical Vertex Already Stored, Otherwise Store It Next
+        if(remap[index] == std::numeric_limits<uint32_t>::max()) {
+            FetchVertex vertex {mesh.positions[index], hasNormals ? mesh.normals[index] : glm::vec3(0.0f), hasTexCoords ? mesh.texCoords[index] : glm::vec2(0.0f)};
+            const auto [uniqueVertex, inserted] {uniqueVertices.try_emplace(vertex, static_cast<uint32_t>(fetchOrdered.positions.size()))};
+            if(inserted) {
+                fetchOrdered.positions.push_back(vertex.position);
+                if(hasNormals) fetchOrdered.normals.push_back(vertex.normal);
+                if(hasTexCoords) fetchOrdered.texCoords.push_back(vertex.texCoord);
+            }
+            remap[index] = uniqueVertex->second;
+        }
+        index = remap[index];
+    }
+    mesh.positions = std::move(fetchOrdered.positions);
+    mesh.normals = std::move(fetchOrdered.normals);
+    mesh.texCoords = std::move(fetchOrdered.texCoords);
+}
+
+// Average Cache Miss Ratio - Post-Transform Cache Misses Per Triangle For a FIFO Cache of cacheSize Vertices (0.5 Is Ideal, 3 Is Worst)
+float sgl::getACMR(const MeshData &mesh, const int &cacheSize) {
+    if(mesh.indices.empty()) return 0.0f;
+    std::vector<uint32_t> cacheTimes(mesh.positions.size(), 0);
+    uint32_t cacheTime {static_cast<uint32_t>(cacheSize) + 1}, misses {0};
+    for(const uint32_t &index : mesh.indices) {
+        if(cacheTime - cacheTimes[index] > static_cast<uint32_t>(cacheSize)) {
+            cacheTimes[index] = cacheTime++;
+            misses++;
+        }
+    }
+    return static_cast<float>(misses) / static_cast<float>(mesh.getTriangleCount());
+}
@@ -0,0 +1,351 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<numeric>
+#include<limits>
+
+// Vertex Kinds - Manifold Vertices Collapse Along Any Edge, Border Vertices Only Along Border Edges, Locked Ones Never
+static const uint8_t vertexManifold {0}, vertexBorder {1}, vertexLocked {2};
+
+// Weight of The Planes Holding Border Edges in Place, Relative to Triangle Planes
+static const double borderWeight {10.0};
+
+// Quadric - Symmetric 4x4 Matrix Summing Squared Distances to Weighted Planes, and The Total Weight
+struct Quadric {
+    double a00 {0.0}, a01 {0.0}, a02 {0.0}, a03 {0.0}, a11 {0.0}, a12 {0.0}, a13 {0.0}, a22 {0.0}, a23 {0.0}, a33 {0.0}, weight {0.0};
+
+    // Add Plane Through point With Unit normal
+    void addPlane(const glm::dvec3 &normal, const glm::dvec3 &point, const double &planeWeight) {
+        const double d {-glm::dot(normal, point)};
+        this->a00 += planeWeight * normal.x * normal.x;
+        this->a01 += planeWeight * normal.x * normal.y;
+        this->a02 += planeWeight * normal.x * normal.z;
+        this->a03 += planeWeight * normal.x * d;
+        this->a11 += planeWeight * normal.y * normal.y;
+        this->a12 += planeWeight * normal.y * normal.z;
+        this->a13 += planeWeight * normal.y * d;
+        this->a22 += planeWeight * normal.z * normal.z;
+        this->a23 += planeWeight * normal.z * d;
+        this->a33 += planeWeight * d * d;
+        this->weight += planeWeight;
+    }
+
+    // Add Another Quadric
+    void add(const Quadric &other) {
+        this->a00 += other.a00; this->a01 += other.a01; this->a02 += other.a02; this->a03 += other.a03;
+        this->a11 += other.a11; this->a12 += other.a12; this->a13 += other.a13;
+        this->a22 += other.a22; this->a23 += other.a23; this->a33 += other.a33;
+        this->weight += other.weight;
+    }
+
+    // Root Mean Squared Distance From a Point to The Planes
+    float getError(const glm::vec3 &point) const {
+        if(this->weight <= 0.0) return 0.0f;
+        const double x {point.x}, y {point.y}, z {point.z};
+        const double sum {
+            this->a00 * x * x + 2.0 * this->a01 * x * y + 2.0 * this->a02 * x * z + 2.0 * this->a03 * x +
+            this->a11 * y * y + 2.0 * this->a12 * y * z + 2.0 * this->a13 * y +
+            this->a22 * z * z + 2.0 * this->a23 * z + this->a33
+        };
+        return static_cast<float>(std::sqrt(std::max(sum / this->weight, 0.0)));
+    }
+};
+
+// Undirected Edge Key - Smaller Vertex in The High Bits So Sorted Keys Group Each Edge's Occurrences
+static uint64_t edgeKey(const uint32_t &a, const uint32_t &b) {
+    return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+}
+
+// Simplify Mesh - Quadric Error Metric Edge Collapse Until targetTriangles Remain or The Next Collapse Would Exceed maxError
+// Vertices on UV/Normal Seams Stay Put and Border Vertices Only Slide Along The Border - Returns The Object-Space Error Reached
+// Works in Passes - Each Pass Sorts Every Candidate Collapse by Error and Applies The Cheapest Ones That Don't Touch Each Other
+float sgl::simplifyMesh(const MeshData &mesh, const size_t &targetTriangles, const float &maxError, MeshData &simplified) {
+    const uint32_t vertexCount {static_cast<uint32_t>(mesh.positions.size())};
+    const bool hasNormals {mesh.normals.size() == vertexCount}, hasTexCoords {mesh.texCoords.size() == vertexCount};
+    std::vector<uint32_t> indices {mesh.indices};
+    const std::vector<glm::vec3> &positions {mesh.positions};
+
+    // Group Vertices by Position - Exact Duplicates Are Welded, Groups Left With Several Vertices Lie on a Seam
+    std::vector<uint32_t> canonical(vertexCount), weld(vertexCount);
+    std::vector<uint8_t> kinds(vertexCount, vertexManifold);
+    {
+        std::vector<uint32_t> order(vertexCount);
+        std::iota(order.begin(), order.end(), 0);
+        const auto positionLess = [&](const uint32_t &a, const uint32_t &b) {
+            const glm::vec3 &pa {positions[a]}, &pb {positions[b]};
+            return pa.x != pb.x ? pa.x < pb.x : (pa.y != pb.y ? pa.y < pb.y : (pa.z != pb.z ? pa.z < pb.z : a < b));
+        };
+        std::sort(order.begin(), order.end(), positionLess);
+        for(uint32_t first {0}; first < vertexCount;) {
+            uint32_t last {first + 1};
+            while(last < vertexCount && positions[order[last]] == positions[order[first]]) last++;
+
+            // Weld Vertices Whose Attributes Match an Earlier One in The Group, The Rest Make The Group a Seam
+            uint32_t distinct {0};
+            for(uint32_t i {first}; i < last; i++) {
+                const uint32_t vertex {order[i]};
+                canonical[vertex] = order[first];
+                weld[vertex] = vertex;
+                for(uint32_t j {first}; j < i; j++) {
+                    const uint32_t other {order[j]};
+                    if(weld[other] != other) continue;
+                    if(hasNormals && mesh.normals[vertex] != mesh.normals[other]) continue;
+                    if(hasTexCoords && mesh.texCoords[vertex] != mesh.texCoords[other]) continue;
+                    weld[vertex] = other;
+                    break;
+                }
+                if(weld[vertex] == vertex) distinct++;
+            }
+            if(distinct > 1) {
+                for(uint32_t i {first}; i < last; i++) kinds[order[i]] = vertexLocked;
+            }
+            first = last;
+        }
+        for(uint32_t &index : indices) index = weld[index];
+    }
+
+    // Submesh of Each Triangle - Triangles Keep Their Order, So Each Submesh Stays a Contiguous Range
+    std::vector<uint32_t> triangleSubmeshes(indices.size() / 3, 0);
+    for(uint32_t submesh {0}; submesh < mesh.submeshes.size(); submesh++) {
+        const MeshSubmesh &range {mesh.submeshes[submesh]};
+        for(uint32_t triangle {range.firstIndex / 3}; triangle < (range.firstIndex + range.numIndices) / 3 && triangle < triangleSubmeshes.size(); triangle++) {
+            triangleSubmeshes[triangle] = submesh;
+        }
+    }
+
+    // Drop Triangles With Two Corners at One Position - They Have No Area and No Edges to Collapse
+    size_t keptTriangles {0};
+    for(size_t triangle {0}; triangle < triangleSubmeshes.size(); triangle++) {
+        const uint32_t i0 {indices[triangle * 3]}, i1 {indices[triangle * 3 + 1]}, i2 {indices[triangle * 3 + 2]};
+        if(canonical[i0] == canonical[i1] || canonical[i1] == canonical[i2] || canonical[i2] == canonical[i0]) continue;
+        indices[keptTriangles * 3] = i0;
+        indices[keptTriangles * 3 + 1] = i1;
+        indices[keptTriangles * 3 + 2] = i2;
+        triangleSubmeshes[keptTriangles++] = triangleSubmeshes[triangle];
+    }
+    indices.resize(keptTriangles * 3);
+    triangleSubmeshes.resize(keptTriangles);
+
+    // Quadrics Per Position From The Planes of Its Triangles, Weighted by Area
+    std::vector<Quadric> quadrics(vertexCount);
+    const size_t sourceTriangles {indices.size() / 3};
+    for(size_t triangle {0}; triangle < sourceTriangles; triangle++) {
+        const uint32_t* corners {&indices[triangle * 3]};
+        const glm::dvec3 p0 {positions[corners[0]]}, p1 {positions[corners[1]]}, p2 {positions[corners[2]]};
+        const glm::dvec3 normal {glm::cross(p1 - p0, p2 - p0)};
+        const double length {glm::length(normal)};
+        if(length <= 0.0) continue;
+        for(int corner {0}; corner < 3; corner++) {
+            quadrics[canonical[corners[corner]]].addPlane(normal / length, p0, length * 0.5);
+        }
+    }
+
+    // Classify Edges - Border Edges Get a Perpendicular Plane Keeping Them in Place, Non-Manifold and Submesh Boundary Edges Lock Their Vertices
+    std::vector<std::pair<uint64_t, uint32_t>> triangleEdges;
+    triangleEdges.reserve(indices.size());
+    for(size_t triangle {0}; triangle < sourceTriangles; triangle++) {
+        for(int corner {0}; corner < 3; corner++) {
+            const uint32_t a {canonical[indices[triangle * 3 + corner]]}, b {canonical[indices[triangle * 3 + (corner + 1) % 3]]};
+            if(a != b) triangleEdges.push_back({edgeKey(a, b), static_cast<uint32_t>(triangle)});
+        }
+    }
+    std::sort(triangleEdges.begin(), triangleEdges.end());
+    for(size_t first {0}; first < triangleEdges.size();) {
+        size_t last {first + 1};
+        while(last < triangleEdges.size() && triangleEdges[last].first == triangleEdges[first].first) last++;
+        const uint32_t a {static_cast<uint32_t>(triangleEdges[first].first >> 32)}, b {static_cast<uint32_t>(triangleEdges[first].first)};
+        if(last - first > 2 || (last - first == 2 && triangleSubmeshes[triangleEdges[first].second] != triangleSubmeshes[triangleEdges[first + 1].second])) {
+            kinds[a] = kinds[b] = vertexLocked;
+        } else if(last - first == 1) {
+            const uint32_t* corners {&indices[triangleEdges[first].second * 3]};
+            const glm::dvec3 p0 {positions[corners[0]]}, p1 {positions[corners[1]]}, p2 {positions[corners[2]]};
+            const glm::dvec3 edge {glm::dvec3(positions[b]) - glm::dvec3(positions[a])};
+            const glm::dvec3 borderNormal {glm::cross(edge, glm::cross(p1 - p0, p2 - p0))};
+            const double length {glm::length(borderNormal)};
+            if(length > 0.0) {
+                const double edgeWeight {glm::dot(edge, edge) * borderWeight};
+                quadrics[a].addPlane(borderNormal / length, positions[a], edgeWeight);
+                quadrics[b].addPlane(borderNormal / length, positions[a], edgeWeight);
+            }
+            for(const uint32_t &vertex : {a, b}) {
+                if(kinds[vertex] == vertexManifold) kinds[vertex] = vertexBorder;
+            }
+        }
+        first = last;
+    }
+
+    // Collapse in Passes
+    struct Collapse {
+        uint32_t from, to;
+        float error;
+    };
+    std::vector<uint64_t> edges;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> triangleOffsets(vertexCount + 1), vertexTriangles, collapseTargets(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+    std::vector<uint32_t> fromNeighbors, toNeighbors;
+    float resultError {0.0f};
+    while(indices.size() / 3 > targetTriangles) {
+        const uint32_t triangleCount {static_cast<uint32_t>(indices.size() / 3)};
+
+        // Triangles Around Each Position
+        std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0);
+        for(const uint32_t &index : indices) triangleOffsets[canonical[index] + 1]++;
+        for(uint32_t vertex {0}; vertex < vertexCount; vertex++) triangleOffsets[vertex + 1] += triangleOffsets[vertex];
+        vertexTriangles.resize(indices.size());
+        {
+            std::vector<uint32_t> fill(triangleOffsets.begin(), triangleOffsets.end() - 1);
+            for(uint32_t triangle {0}; triangle < triangleCount; triangle++) {
+                for(int corner {0}; corner < 3; corner++) vertexTriangles[fill[canonical[indices[triangle * 3 + corner]]]++] = triangle;
+            }
+        }
+
+        // Candidate Collapses Along Every Edge, Both Directions - Border Vertices Only Move Along Border Edges
+        edges.clear();
+        for(uint32_t triangle {0}; triangle < triangleCount; triangle++) {
+            for(int corner {0}; corner < 3; corner++) {
+                edges.push_back(edgeKey(canonical[indices[triangle * 3 + corner]], canonical[indices[triangle * 3 + (corner + 1) % 3]]));
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        collapses.clear();
+        for(size_t first {0}; first < edges.size();) {
+            size_t last {first + 1};
+            while(last < edges.size() && edges[last] == edges[first]) last++;
+            const uint32_t a {static_cast<uint32_t>(edges[first] >> 32)}, b {static_cast<uint32_t>(edges[first])};
+            const bool borderEdge {last - first == 1};
+            for(const auto &[from, to] : {std::make_pair(a, b), std::make_pair(b, a)}) {
+                if(kinds[from] == vertexLocked || (kinds[from] == vertexBorder && !borderEdge)) continue;
+                Quadric quadric {quadrics[from]};
+                quadric.add(quadrics[to]);
+                collapses.push_back({from, to, quadric.getError(positions[to])});
+            }
+            first = last;
+        }
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse &a, const Collapse &b) {return a.error < b.error;});
+
+        // Apply The Cheapest Collapses - Vertices Around a Collapse Are Left For The Next Pass
+        std::fill(touched.begin(), touched.end(), 0);
+        std::iota(collapseTargets.begin(), collapseTargets.end(), 0);
+        const size_t trianglesToRemove {triangleCount - targetTriangles};
+        size_t removedTriangles {0}, appliedCollapses {0};
+        for(const Collapse &collapse : collapses) {
+            if(collapse.error > maxError || removedTriangles >= trianglesToRemove) break;
+            if(touched[collapse.from] || touched[collapse.to]) continue;
+
+            // Triangles Shared With The Target Disappear - Their Target Corner Gives The Vertex The Moved Corners Now Use
+            uint32_t targetVertex {UINT32_MAX};
+            size_t sharedTriangles {0};
+            bool valid {true};
+            fromNeighbors.clear();
+            for(uint32_t i {triangleOffsets[collapse.from]}; i < triangleOffsets[collapse.from + 1] && valid; i++) {
+                const uint32_t* corners {&indices[vertexTriangles[i] * 3]};
+                bool shared {false};
+                for(int corner {0}; corner < 3; corner++) {
+                    const uint32_t vertex {canonical[corners[corner]]};
+                    if(vertex == collapse.to) {
+                        shared = true;
+                        if(targetVertex != UINT32_MAX && targetVertex != corners[corner]) valid = false;
+                        targetVertex = corners[corner];
+                    }
+                    if(vertex != collapse.from && std::find(fromNeighbors.begin(), fromNeighbors.end(), vertex) == fromNeighbors.end()) fromNeighbors.push_back(vertex);
+                }
+                if(shared) {
+                    sharedTriangles++;
+                    continue;
+                }
+
+                // Flip Check - Reject Collapses That Turn a Remaining Triangle Over
+                glm::vec3 before[3], after[3];
+                for(int corner {0}; corner < 3; corner++) {
+                    before[corner] = positions[corners[corner]];
+                    after[corner] = canonical[corners[corner]] == collapse.from ? positions[collapse.to] : before[corner];
+                }
+                const glm::vec3 normalBefore {glm::cross(before[1] - before[0], before[2] - before[0])};
+                const glm::vec3 normalAfter {glm::cross(after[1] - after[0], after[2] - after[0])};
+                if(glm::dot(normalBefore, normalAfter) <= 0.25f * glm::length(normalBefore) * glm::length(normalAfter)) valid = false;
+            }
+            if(!valid || targetVertex == UINT32_MAX) continue;
+
+            // Link Condition - Shared Neighbors Must Only Be Those of The Removed Triangles, Otherwise The Mesh Would Pinch
+            toNeighbors.clear();
+            for(uint32_t i {triangleOffsets[collapse.to]}; i < triangleOffsets[collapse.to + 1]; i++) {
+                for(int corner {0}; corner < 3; corner++) {
+                    const uint32_t vertex {canonical[indices[vertexTriangles[i] * 3 + corner]]};
+                    if(vertex != collapse.to && std::find(toNeighbors.begin(), toNeighbors.end(), vertex) == toNeighbors.end()) toNeighbors.push_back(vertex);
+                }
+            }
+            size_t sharedNeighbors {0};
+            for(const uint32_t &vertex : fromNeighbors) {
+                if(vertex != collapse.to && std::find(toNeighbors.begin(), toNeighbors.end(), vertex) != toNeighbors.end()) sharedNeighbors++;
+            }
+            if(sharedNeighbors != sharedTriangles) continue;
+
+            // Collapse - The Source Vertex Is Not on a Seam, So It Is Its Own Canonical Vertex
+            collapseTargets[collapse.from] = targetVertex;
+            quadrics[collapse.to].add(quadrics[collapse.from]);
+            touched[collapse.from] = touched[collapse.to] = 1;
+            for(const uint32_t &vertex : fromNeighbors) touched[vertex] = 1;
+            resultError = std::max(resultError, collapse.error);
+            removedTriangles += sharedTriangles;
+            appliedCollapses++;
+        }
+        if(appliedCollapses == 0) break;
+
+        // Redirect Collapsed Vertices and Drop Triangles That Became Degenerate
+        size_t writeIndex {0};
+        for(uint32_t triangle {0}; triangle < triangleCount; triangle++) {
+            const uint32_t i0 {collapseTargets[indices[triangle * 3]]}, i1 {collapseTargets[indices[triangle * 3 + 1]]}, i2 {collapseTargets[indices[triangle * 3 + 2]]};
+            if(canonical[i0] == canonical[i1] || canonical[i1] == canonical[i2] || canonical[i2] == canonical[i0]) continue;
+            indices[writeIndex++] = i0;
+            indices[writeIndex++] = i1;
+            indices[writeIndex++] = i2;
+            triangleSubmeshes[writeIndex / 3 - 1] = triangleSubmeshes[triangle];
+        }
+        indices.resize(writeIndex);
+        triangleSubmeshes.resize(writeIndex / 3);
+    }
+
+    // Compact Vertices Still Referenced
+    std::vector<uint32_t> remap(vertexCount, UINT32_MAX);
+    simplified = {};
+    simplified.indices.reserve(indices.size());
+    for(const uint32_t &index : indices) {
+        if(remap[index] == UINT32_MAX) {
+            remap[index] = static_cast<uint32_t>(simplified.positions.size());
+            simplified.positions.push_back(positions[index]);
+            if(hasNormals) simplified.normals.push_back(mesh.normals[index]);
+            if(hasTexCoords) simplified.texCoords.push_back(mesh.texCoords[index]);
+        }
+        simplified.indices.push_back(remap[index]);
+    }
+
+    // Submesh Ranges From The Surviving Triangles, Empty Submeshes Included So Their Indices Still Match The Source's
+    uint32_t firstIndex {0};
+    for(uint32_t submesh {0}; submesh < mesh.submeshes.size(); submesh++) {
+        const uint32_t numIndices {static_cast<uint32_t>(std::count(triangleSubmeshes.begin(), triangleSubmeshes.end(), submesh)) * 3};
+        simplified.submeshes.push_back({firstIndex, numIndices});
+        firstIndex += numIndices;
+    }
+    return resultError;
+}
+
+// Build LOD Chain - Level 0 Is The Source, Each Level Keeps About triangleRatio of The Previous Level's Triangles
+// Stops Early Once Simplification Stalls (Seams and Borders Left Nothing to Collapse)
+std::vector<sgl::MeshLOD> sgl::buildLODChain(const MeshData &mesh, const int &maxLevels, const float &triangleRatio) {
+    std::vector<MeshLOD> chain {{mesh, 0.0f}};
+    for(int level {1}; level < maxLevels; level++) {
+        // Simplify The Previous Level - Errors Add Up, Giving an Upper Bound on The Error Against The Source
+        const MeshLOD &previous {chain.back()};
+        const size_t previousTriangles {previous.mesh.getTriangleCount()};
+        const size_t targetTriangles {static_cast<size_t>(static_cast<float>(previousTriangles) * triangleRatio)};
+        if(targetTriangles == 0) break;
+        MeshLOD lod;
+        lod.error = previous.error + simplifyMesh(previous.mesh, targetTriangles, std::numeric_limits<float>::max(), lod.mesh);
+
+        // Stalled - Less Than a Tenth of The Triangles Went Away
+        if(lod.mesh.getTriangleCount() * 10 > previousTriangles * 9) break;
+        chain.push_back(std::move(lod));
+    }
+    return chain;
+}
@@ -0,0 +1,138 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<charconv>
+
+// Face Corner - Position, TexCoord and Normal Indices (0 When Missing), The Key Identical Corners Share a Vertex By
+struct ObjCorner {
+    int position, texCoord, normal;
+    bool operator==(const ObjCorner &other) const {
+        return this->position == other.position && this->texCoord == other.texCoord && this->normal == other.normal;
+    }
+};
+struct ObjCornerHash {
+    size_t operator()(const ObjCorner &corner) const {return static_cast<size_t>(sgl::hashBytes(&corner, sizeof(corner)));}
+};
+
+// Skip Spaces and Tabs
+static const char* skipSpaces(const char* cursor, const char* lineEnd) {
+    while(cursor < lineEnd && (*cursor == ' ' || *cursor == '\t')) cursor++;
+    return cursor;
+}
+
+// Parse Floats Separated by Spaces Into values - False if Fewer Than count Were Found
+static bool parseFloats(const char* cursor, const char* lineEnd, float* values, const int &count) {
+    for(int i {0}; i < count; i++) {
+        cursor = skipSpaces(cursor, lineEnd);
+        const std::from_chars_result result {std::from_chars(cursor, lineEnd, values[i])};
+        if(result.ec != std::errc()) return false;
+        cursor = result.ptr;
+    }
+    return true;
+}
+
+// Parse an Index Within a Face Corner - Negative Indices Count Back From The Last Element, Missing Ones Are 0
+static const char* parseIndex(const char* cursor, const char* lineEnd, const size_t &elementCount, int &index) {
+    index = 0;
+    if(cursor >= lineEnd || *cursor == '/' || *cursor == ' ' || *cursor == '\t') return cursor;
+    const std::from_chars_result result {std::from_chars(cursor, lineEnd, index)};
+    if(result.ec != std::errc()) {
+        index = -1;
+        return cursor;
+    }
+    if(index < 0) index += static_cast<int>(elementCount) + 1;
+    if(index <= 0 || index > static_cast<int>(elementCount)) index = -1;
+    return result.ptr;
+}
+
+// Load Wavefront OBJ File - Polygons Are Triangulated, Each usemtl Starts a Submesh and Identical v/vt/vn Corners Share a Vertex
+bool sgl::loadOBJ(const std::string &objFilePath, MeshData &mesh) {
+    MappedFile objFile(objFilePath);
+    if(!objFile.isOpen()) return false;
+    mesh = {};
+
+    // Elements Read So Far and The Vertex Made For Each Distinct Face Corner
+    std::vector<glm::vec3> objPositions, objNormals;
+    std::vector<glm::vec2> objTexCoords;
+    std::unordered_map<ObjCorner, uint32_t, ObjCornerHash> cornerVertices;
+    bool hasTexCoords {false}, hasNormals {false};
+    std::vector<uint32_t> faceVertices;
+    mesh.submeshes.push_back({0, 0});
+
+    // Parse Line by Line
+    const char* cursor {reinterpret_cast<const char*>(objFile.getData())};
+    const char* fileEnd {cursor + objFile.getSize()};
+    size_t lineNumber {0};
+    for(const char* lineEnd {cursor}; cursor < fileEnd; cursor = lineEnd + 1) {
+        lineNumber++;
+        lineEnd = static_cast<const char*>(std::memchr(cursor, '\n', static_cast<size_t>(fileEnd - cursor)));
+        if(!lineEnd) lineEnd = fileEnd;
+        const char* lineStart {skipSpaces(cursor, lineEnd)};
+        const std::string_view line(lineStart, static_cast<size_t>(lineEnd - lineStart));
+
+        // Vertex Positions, Texture Coordinates and Normals
+        bool valid {true};
+        if(line.starts_with("v ")) {
+            float values[3];
+            valid = parseFloats(lineStart + 2, lineEnd, values, 3);
+            if(valid) objPositions.push_back({values[0], values[1], values[2]});
+        } else if(line.starts_with("vt ")) {
+            float values[2];
+            valid = parseFloats(lineStart + 3, lineEnd, values, 2);
+            if(valid) objTexCoords.push_back({values[0], values[1]});
+        } else if(line.starts_with("vn ")) {
+            float values[3];
+            valid = parseFloats(lineStart + 3, lineEnd, values, 3);
+            if(valid) objNormals.push_back({values[0], values[1], values[2]});
+        } else if(line.starts_with("usemtl")) {
+            // New Material - Start a Submesh Unless The Current One Is Still Empty
+            if(mesh.submeshes.back().numIndices > 0) mesh.submeshes.push_back({static_cast<uint32_t>(mesh.indices.size()), 0});
+        } else if(line.starts_with("f ")) {
+            // Face Corners - v, v/vt, v//vn or v/vt/vn
+            faceVertices.clear();
+            const char* corner {skipSpaces(lineStart + 2, lineEnd)};
+            while(valid && corner < lineEnd && *corner != '\r') {
+                ObjCorner objCorner {0, 0, 0};
+                corner = parseIndex(corner, lineEnd, objPositions.size(), objCorner.position);
+                if(corner < lineEnd && *corner == '/') corner = parseIndex(corner + 1, lineEnd, objTexCoords.size(), objCorner.texCoord);
+                if(corner < lineEnd && *corner == '/') corner = parseIndex(corner + 1, lineEnd, objNormals.size(), objCorner.normal);
+                if(objCorner.position <= 0 || objCorner.texCoord < 0 || objCorner.normal < 0) {
+                    valid = false;
+                    break;
+                }
+
+                // Vertex For This Corner - Reuse The One Made For an Identical Corner
+                const auto [vertex, inserted] {cornerVertices.try_emplace(objCorner, static_cast<uint32_t>(mesh.positions.size()))};
+                if(inserted) {
+                    mesh.positions.push_back(objPositions[objCorner.position - 1]);
+                    mesh.texCoords.push_back(objCorner.texCoord > 0 ? objTexCoords[objCorner.texCoord - 1] : glm::vec2(0.0f));
+                    mesh.normals.push_back(objCorner.normal > 0 ? objNormals[objCorner.normal - 1] : glm::vec3(0.0f));
+                    hasTexCoords |= objCorner.texCoord > 0;
+                    hasNormals |= objCorner.normal > 0;
+                }
+                faceVertices.push_back(vertex->second);
+                corner = skipSpaces(corner, lineEnd);
+            }
+            valid = valid && faceVertices.size() >= 3;
+
+            // Triangulate as a Fan
+            for(size_t i {2}; valid && i < faceVertices.size(); i++) {
+                mesh.indices.insert(mesh.indices.end(), {faceVertices[0], faceVertices[i - 1], faceVertices[i]});
+                mesh.submeshes.back().numIndices += 3;
+            }
+        }
+
+        // Display Error Message
+        if(!valid) {
+            std::cerr << "Failed to Parse OBJ File: " << objFilePath << " (Line " << lineNumber << ")" << std::endl;
+            mesh = {};
+            return false;
+        }
+    }
+
+    // Drop Attributes No Face Used and a Trailing Empty Submesh
+    if(!hasTexCoords) mesh.texCoords.clear();
+    if(!hasNormals) mesh.normals.clear();
+    if(mesh.submeshes.size() > 1 && mesh.submeshes.back().numIndices == 0) mesh.submeshes.pop_back();
+    return true;
+}
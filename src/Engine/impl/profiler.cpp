@@ -0,0 +1,141 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<fstream>
+
+// Constructor - Number of Frames Kept
+sgl::Profiler::Profiler(const int &maxFrames) {
+    // Set Up sokol_time Once - Calling It Again Would Move The Time Origin Under Other Profilers
+    static std::once_flag timeSetup;
+    std::call_once(timeSetup, stm_setup);
+    this->frames.resize(std::max(maxFrames, 1));
+}
+
+// Begin Frame
+void sgl::Profiler::beginFrame(void) {
+    // Reuse The Oldest Frame's Storage
+    Frame &frame {this->frames[this->frameCount % this->frames.size()]};
+    frame.index = this->frameCount;
+    frame.zones.clear();
+    frame.counters.clear();
+    frame.stats = {};
+
+    // Frame Start and Time Since The Previous Frame Started (0 For The First Frame)
+    frame.interval = stm_laptime(&this->lastFrameStart);
+    frame.start = this->lastFrameStart;
+    this->openZones.clear();
+    this->inFrame = true;
+}
+
+// End Frame - End After sg_commit So The Frame's Sokol Stats Are Captured
+void sgl::Profiler::endFrame(void) {
+    if(!this->inFrame) return;
+
+    // Close Zones Left Open
+    while(!this->openZones.empty()) this->endZone();
+
+    // Frame End and Sokol Stats - sg_query_frame_stats Returns The Frame Just Committed
+    Frame &frame {this->frames[this->frameCount % this->frames.size()]};
+    frame.end = stm_now();
+    frame.stats = sg_query_frame_stats();
+    this->frameCount++;
+    this->inFrame = false;
+}
+
+// Begin Zone
+void sgl::Profiler::beginZone(const char* name) {
+    if(!this->inFrame) return;
+    Frame &frame {this->frames[this->frameCount % this->frames.size()]};
+    const int parent {this->openZones.empty() ? -1 : this->openZones.back()};
+    frame.zones.push_back({name, stm_now(), 0, parent, static_cast<int>(this->openZones.size())});
+    this->openZones.push_back(static_cast<int>(frame.zones.size() - 1));
+}
+
+// End Zone
+void sgl::Profiler::endZone(void) {
+    if(!this->inFrame || this->openZones.empty()) return;
+    Frame &frame {this->frames[this->frameCount % this->frames.size()]};
+    frame.zones[this->openZones.back()].end = stm_now();
+    this->openZones.pop_back();
+}
+
+// Set Counter For The Current Frame - Setting It Again Replaces The Value
+void sgl::Profiler::setCounter(const char* name, const double &value) {
+    if(!this->inFrame) return;
+    Frame &frame {this->frames[this->frameCount % this->frames.size()]};
+    for(Counter &counter : frame.counters) {
+        if(std::strcmp(counter.name, name) == 0) {
+            counter.value = value;
+            return;
+        }
+    }
+    frame.counters.push_back({name, value});
+}
+
+// Write Recorded Frames as a Chrome Trace (chrome://tracing, Perfetto) - Zones as Events, Counters and Sokol Stats as Counters
+bool sgl::Profiler::writeChromeTrace(const std::filesystem::path &path) {
+    // Open Trace File
+    std::ofstream file(path);
+    if(!file) {
+        // Display Error Message
+        std::cerr << "Failed to Write Chrome Trace: " << path << std::endl;
+        return false;
+    }
+
+    // Complete Event - Timestamps and Durations in Microseconds
+    bool firstEvent {true};
+    auto writeEvent = [&](const char* name, const char* phase, const uint64_t &start, const uint64_t &end) {
+        file << (firstEvent ? "\n" : ",\n") << "{\"name\": \"" << name << "\", \"ph\": \"" << phase
+             << "\", \"pid\": 1, \"tid\": 1, \"ts\": " << stm_us(start);
+        if(phase[0] == 'X') file << ", \"dur\": " << stm_us(stm_diff(end, start));
+        firstEvent = false;
+    };
+
+    // Frames Oldest First
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    const int numFrames {this->getFrameCount()};
+    for(int framesAgo {numFrames - 1}; framesAgo >= 0; framesAgo--) {
+        const Frame &frame {*this->getFrame(framesAgo)};
+
+        // Frame Event
+        writeEvent("Frame", "X", frame.start, frame.end);
+        file << ", \"args\": {\"frame\": " << frame.index << ", \"intervalMs\": " << stm_ms(frame.interval) << "}}";
+
+        // Zone Events
+        for(const Zone &zone : frame.zones) {
+            writeEvent(zone.name, "X", zone.start, zone.end);
+            file << "}";
+        }
+
+        // Counters
+        for(const Counter &counter : frame.counters) {
+            writeEvent(counter.name, "C", frame.start, frame.start);
+            file << ", \"args\": {\"value\": " << counter.value << "}}";
+        }
+
+        // Sokol Frame Stats Counters
+        const sg_frame_stats &stats {frame.stats};
+        writeEvent("Sokol Calls", "C", frame.start, frame.start);
+        file << ", \"args\": {\"draws\": " << stats.num_draw
+             << ", \"applyPipeline\": " << stats.num_apply_pipeline
+             << ", \"applyBindings\": " << stats.num_apply_bindings
+             << ", \"applyUniforms\": " << stats.num_apply_uniforms
+             << ", \"updateBuffer\": " << stats.num_update_buffer
+             << ", \"appendBuffer\": " << stats.num_append_buffer
+             << ", \"updateImage\": " << stats.num_update_image << "}}";
+        writeEvent("Sokol Bytes", "C", frame.start, frame.start);
+        file << ", \"args\": {\"uniforms\": " << stats.size_apply_uniforms
+             << ", \"updateBuffer\": " << stats.size_update_buffer
+             << ", \"appendBuffer\": " << stats.size_append_buffer
+             << ", \"updateImage\": " << stats.size_update_image << "}}";
+    }
+    file << "\n]}" << std::endl;
+    return true;
+}
+
+// Getters - framesAgo 0 Is The Last Completed Frame, nullptr When Not Recorded
+const sgl::Profiler::Frame* sgl::Profiler::getFrame(const int &framesAgo) {
+    if(framesAgo < 0 || framesAgo >= this->getFrameCount()) return nullptr;
+    return &this->frames[(this->frameCount - 1 - framesAgo) % this->frames.size()];
+}
+int sgl::Profiler::getFrameCount(void) {return static_cast<int>(std::min<uint64_t>(this->frameCount, this->frames.size()));}
@@ -0,0 +1,154 @@
+#include"../Engine.hpp"
+
+// Build Sort Key - Pass (4 Bits), Pipeline (16 Bits), Bindings (20 Bits), Depth in [0, 1] (24 Bits)
+uint64_t sgl::RenderQueue::makeSortKey(const uint32_t &pass, const sg_pipeline &pipeline, const uint32_t &bindingsId, const float &depth) {
+    // Pipeline Pool Slot Index - The Low 16 Bits of a Sokol Resource ID, Unique Among Live Pipelines
+    const uint64_t pipelineSlot {pipeline.id & 0xffffu};
+    const uint64_t depthBits {static_cast<uint64_t>(std::clamp(depth, 0.0f, 1.0f) * static_cast<float>(0xffffff))};
+    return (static_cast<uint64_t>(pass & 0xfu) << 60) | (pipelineSlot << 44) | (static_cast<uint64_t>(bindingsId & 0xfffffu) << 24) | depthBits;
+}
+
+// Register Bindings - Returns The Bindings ID Used by Draw Packets, Valid Until removeBindings() (IDs of Removed Bindings Are Reused)
+uint32_t sgl::RenderQueue::addBindings(const sg_bindings &bindings) {
+    // Reuse a Removed ID
+    if(!this->freeBindingsIds.empty()) {
+        const uint32_t bindingsId {this->freeBindingsIds.back()};
+        this->freeBindingsIds.pop_back();
+        this->bindings[bindingsId] = bindings;
+        this->bindingsRegistered[bindingsId] = true;
+        return bindingsId;
+    }
+
+    // New ID - Warn Once When Sort Keys Can No Longer Tell Every Bindings Apart
+    const uint32_t bindingsId {static_cast<uint32_t>(this->bindings.size())};
+    if(bindingsId == maxBindings) {
+        std::cerr << "Render Queue Has More Than " << maxBindings << " Bindings: Draws With Different Bindings Will Share Sort Keys and Batch Worse" << std::endl;
+    }
+    this->bindings.push_back(bindings);
+    this->bindingsRegistered.push_back(true);
+    return bindingsId;
+}
+
+// Remove Registered Bindings - Packets Already Submitted With The ID Must Be Flushed First
+void sgl::RenderQueue::removeBindings(const uint32_t &bindingsId) {
+    if(bindingsId >= this->bindings.size() || !this->bindingsRegistered[bindingsId]) {
+        std::cerr << "Failed to Remove Bindings: ID " << bindingsId << " Was Not Registered" << std::endl;
+        return;
+    }
+    this->bindings[bindingsId] = {};
+    this->bindingsRegistered[bindingsId] = false;
+    this->freeBindingsIds.push_back(bindingsId);
+}
+
+// Replace Registered Bindings - Packets Already Submitted With The ID Draw With The New Bindings at The Next flush()
+void sgl::RenderQueue::setBindings(const uint32_t &bindingsId, const sg_bindings &bindings) {
+    if(bindingsId >= this->bindings.size() || !this->bindingsRegistered[bindingsId]) {
+        std::cerr << "Failed to Set Bindings: ID " << bindingsId << " Was Not Registered" << std::endl;
+        return;
+    }
+    this->bindings[bindingsId] = bindings;
+}
+
+// Add Shared Uniform Block (Per-Frame or Per-Material Data) - Copied, Returns The ID Draw Packets Reference Until The Next flush()
+uint32_t sgl::RenderQueue::addUniforms(const sg_shader_stage &stage, const int &slot, const sg_range &data) {
+    const uint8_t* uniforms {static_cast<const uint8_t*>(data.ptr)};
+    this->uniformBlocks.push_back({stage, slot, static_cast<uint32_t>(this->uniformData.size()), static_cast<uint32_t>(data.size), hashBytes(data.ptr, data.size)});
+    this->uniformData.insert(this->uniformData.end(), uniforms, uniforms + data.size);
+    return static_cast<uint32_t>(this->uniformBlocks.size()) - 1;
+}
+
+// Submit Draw Packet - Uniform Data Is Copied So It Does Not Need to Outlive The Call
+void sgl::RenderQueue::submit(const DrawPacket &packet, const sg_range &vsUniforms) {
+    DrawPacket &queuedPacket {this->packets.emplace_back(packet)};
+    if(packet.vsUniformSlot >= 0) {
+        const uint8_t* uniforms {static_cast<const uint8_t*>(vsUniforms.ptr)};
+        queuedPacket.uniformOffset = static_cast<uint32_t>(this->uniformData.size());
+        queuedPacket.uniformSize = static_cast<uint32_t>(vsUniforms.size);
+        this->uniformData.insert(this->uniformData.end(), uniforms, uniforms + vsUniforms.size);
+    }
+    this->sortEntries.push_back({packet.sortKey, static_cast<uint32_t>(this->packets.size()) - 1});
+}
+
+// Sort Submitted Draw Packets by Key, Then Draw Them in Order and Clear The Queue - Call Inside a Render Pass
+void sgl::RenderQueue::flush(void) {
+    this->sort();
+
+    // Draw Packets - Applying a Pipeline Resets Sokol's Bindings and Uniforms, So a Pipeline Change Always Re-Applies Them
+    uint32_t currentPipeline {SG_INVALID_ID}, currentBindings {UINT32_MAX};
+    for(const SortEntry &sortEntry : this->sortEntries) {
+        const DrawPacket &packet {this->packets[sortEntry.packetIndex]};
+        if(packet.pipeline.id != currentPipeline) {
+            sg_apply_pipeline(packet.pipeline);
+            this->uniformManager.reset();
+            currentPipeline = packet.pipeline.id;
+            currentBindings = UINT32_MAX;
+            this->stats.pipelineApplies++;
+        } else {
+            this->stats.pipelineSkips++;
+        }
+        if(packet.bindingsId != currentBindings) {
+            sg_apply_bindings(this->bindings[packet.bindingsId]);
+            currentBindings = packet.bindingsId;
+            this->stats.bindingsApplies++;
+        } else {
+            this->stats.bindingsSkips++;
+        }
+        for(const uint32_t uniformsId : {packet.frameUniformsId, packet.materialUniformsId}) {
+            if(uniformsId != noUniforms) {
+                const UniformBlock &uniformBlock {this->uniformBlocks[uniformsId]};
+                this->uniformManager.apply(uniformBlock.stage, uniformBlock.slot, {this->uniformData.data() + uniformBlock.offset, uniformBlock.size}, uniformBlock.hash);
+            }
+        }
+        if(packet.vsUniformSlot >= 0) {
+            this->uniformManager.applyChanged(SG_SHADERSTAGE_VS, packet.vsUniformSlot, {this->uniformData.data() + packet.uniformOffset, packet.uniformSize});
+        }
+        sg_draw(packet.baseElement, packet.numElements, packet.numInstances);
+        this->stats.draws++;
+    }
+
+    // Clear The Queue - Capacity Is Kept For The Next Frame
+    this->packets.clear();
+    this->uniformBlocks.clear();
+    this->uniformData.clear();
+    this->sortEntries.clear();
+    this->flushCount++;
+}
+
+// Reset Statistics
+void sgl::RenderQueue::resetStats(void) {this->stats = {};}
+
+// Getters
+const sgl::RenderQueue::Stats &sgl::RenderQueue::getStats(void) {return this->stats;}
+size_t sgl::RenderQueue::getPacketCount(void) {return this->packets.size();}
+uint64_t sgl::RenderQueue::getFlushCount(void) {return this->flushCount;}
+sgl::UniformManager &sgl::RenderQueue::getUniformManager(void) {return this->uniformManager;}
+
+// Radix Sort Sort Entries by Key - Eight Passes Over One Byte Each, Passes Where Every Key Has The Same Byte Are Skipped
+void sgl::RenderQueue::sort(void) {
+    const size_t numEntries {this->sortEntries.size()};
+    if(numEntries < 2) return;
+    this->sortScratch.resize(numEntries);
+
+    // Histogram Every Byte in One Pass Over The Keys
+    size_t counts[8][256] {};
+    for(const SortEntry &sortEntry : this->sortEntries) {
+        for(int byte {0}; byte < 8; byte++) {
+            counts[byte][(sortEntry.key >> (byte * 8)) & 0xff]++;
+        }
+    }
+
+    // Scatter by Each Byte, Least Significant First - Stable, So Earlier Passes Order Ties
+    for(int byte {0}; byte < 8; byte++) {
+        if(counts[byte][(this->sortEntries[0].key >> (byte * 8)) & 0xff] == numEntries) continue;
+        size_t offsets[256];
+        size_t offset {0};
+        for(int bucket {0}; bucket < 256; bucket++) {
+            offsets[bucket] = offset;
+            offset += counts[byte][bucket];
+        }
+        for(const SortEntry &sortEntry : this->sortEntries) {
+            this->sortScratch[offsets[(sortEntry.key >> (byte * 8)) & 0xff]++] = sortEntry;
+        }
+        this->sortEntries.swap(this->sortScratch);
+    }
+}
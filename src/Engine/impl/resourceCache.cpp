@@ -0,0 +1,83 @@
+#include"../Engine.hpp"
+
+// Resource Cache Keys - Zeroed Then Filled In Field by Field, So Padding Bytes Are Always Zero and The Label Is Left Out
+void sgl::makeCacheKey(const sg_sampler_desc &desc, sg_sampler_desc &key) {
+    std::memset(&key, 0, sizeof(key));
+    key.min_filter = desc.min_filter;
+    key.mag_filter = desc.mag_filter;
+    key.mipmap_filter = desc.mipmap_filter;
+    key.wrap_u = desc.wrap_u;
+    key.wrap_v = desc.wrap_v;
+    key.wrap_w = desc.wrap_w;
+    key.min_lod = desc.min_lod;
+    key.max_lod = desc.max_lod;
+    key.border_color = desc.border_color;
+    key.compare = desc.compare;
+    key.max_anisotropy = desc.max_anisotropy;
+    key.gl_sampler = desc.gl_sampler;
+    key.mtl_sampler = desc.mtl_sampler;
+    key.d3d11_sampler = desc.d3d11_sampler;
+    key.wgpu_sampler = desc.wgpu_sampler;
+}
+void sgl::makeCacheKey(const sg_pipeline_desc &desc, sg_pipeline_desc &key) {
+    std::memset(&key, 0, sizeof(key));
+    key.shader.id = desc.shader.id;
+
+    // Vertex Layout
+    for(int i {0}; i < SG_MAX_VERTEX_BUFFERS; i++) {
+        key.layout.buffers[i].stride = desc.layout.buffers[i].stride;
+        key.layout.buffers[i].step_func = desc.layout.buffers[i].step_func;
+        key.layout.buffers[i].step_rate = desc.layout.buffers[i].step_rate;
+    }
+    for(int i {0}; i < SG_MAX_VERTEX_ATTRIBUTES; i++) {
+        key.layout.attrs[i].buffer_index = desc.layout.attrs[i].buffer_index;
+        key.layout.attrs[i].offset = desc.layout.attrs[i].offset;
+        key.layout.attrs[i].format = desc.layout.attrs[i].format;
+    }
+
+    // Depth and Stencil State
+    key.depth.pixel_format = desc.depth.pixel_format;
+    key.depth.compare = desc.depth.compare;
+    key.depth.write_enabled = desc.depth.write_enabled;
+    key.depth.bias = desc.depth.bias;
+    key.depth.bias_slope_scale = desc.depth.bias_slope_scale;
+    key.depth.bias_clamp = desc.depth.bias_clamp;
+    key.stencil.enabled = desc.stencil.enabled;
+    key.stencil.front.compare = desc.stencil.front.compare;
+    key.stencil.front.fail_op = desc.stencil.front.fail_op;
+    key.stencil.front.depth_fail_op = desc.stencil.front.depth_fail_op;
+    key.stencil.front.pass_op = desc.stencil.front.pass_op;
+    key.stencil.back.compare = desc.stencil.back.compare;
+    key.stencil.back.fail_op = desc.stencil.back.fail_op;
+    key.stencil.back.depth_fail_op = desc.stencil.back.depth_fail_op;
+    key.stencil.back.pass_op = desc.stencil.back.pass_op;
+    key.stencil.read_mask = desc.stencil.read_mask;
+    key.stencil.write_mask = desc.stencil.write_mask;
+    key.stencil.ref = desc.stencil.ref;
+
+    // Color Targets
+    key.color_count = desc.color_count;
+    for(int i {0}; i < SG_MAX_COLOR_ATTACHMENTS; i++) {
+        key.colors[i].pixel_format = desc.colors[i].pixel_format;
+        key.colors[i].write_mask = desc.colors[i].write_mask;
+        key.colors[i].blend.enabled = desc.colors[i].blend.enabled;
+        key.colors[i].blend.src_factor_rgb = desc.colors[i].blend.src_factor_rgb;
+        key.colors[i].blend.dst_factor_rgb = desc.colors[i].blend.dst_factor_rgb;
+        key.colors[i].blend.op_rgb = desc.colors[i].blend.op_rgb;
+        key.colors[i].blend.src_factor_alpha = desc.colors[i].blend.src_factor_alpha;
+        key.colors[i].blend.dst_factor_alpha = desc.colors[i].blend.dst_factor_alpha;
+        key.colors[i].blend.op_alpha = desc.colors[i].blend.op_alpha;
+    }
+
+    // Rasterizer State
+    key.primitive_type = desc.primitive_type;
+    key.index_type = desc.index_type;
+    key.cull_mode = desc.cull_mode;
+    key.face_winding = desc.face_winding;
+    key.sample_count = desc.sample_count;
+    key.blend_color.r = desc.blend_color.r;
+    key.blend_color.g = desc.blend_color.g;
+    key.blend_color.b = desc.blend_color.b;
+    key.blend_color.a = desc.blend_color.a;
+    key.alpha_to_coverage_enabled = desc.alpha_to_coverage_enabled;
+}
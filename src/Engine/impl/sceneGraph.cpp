@@ -0,0 +1,216 @@
+#include"../Engine.hpp"
+
+// Dirty Flag - Node Is Already in The Dirty List
+static const uint8_t nodeDirty {1};
+
+// Add Node as The Last Child of parent (invalidNode For a Root) - Later Nodes Shift, So Build Parents First
+sgl::SceneGraph::NodeId sgl::SceneGraph::addNode(const NodeId &parent, const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale, const AABB &localBounds) {
+    // Insert After The Parent's Current Subtree, or at The End For a Root
+    const bool hasParent {parent != invalidNode && parent < this->nodeIndices.size() && this->nodeIndices[parent] != UINT32_MAX};
+    if(parent != invalidNode && !hasParent) {
+        // Display Error Message and Add as a Root
+        std::cerr << "Failed to Find Scene Node " << parent << " - Adding Node as a Root" << std::endl;
+    }
+    const uint32_t parentIndex {hasParent ? this->nodeIndices[parent] : UINT32_MAX};
+    const uint32_t index {hasParent ? this->subtreeEnds[parentIndex] : static_cast<uint32_t>(this->parents.size())};
+    this->insertSlot(index);
+
+    // Ancestors' Subtrees Grow by One
+    for(int ancestor {hasParent ? static_cast<int>(parentIndex) : -1}; ancestor >= 0; ancestor = this->parents[ancestor]) {
+        this->subtreeEnds[ancestor]++;
+    }
+
+    // Node ID - Reuse a Freed One if Possible
+    NodeId node {static_cast<NodeId>(this->nodeIndices.size())};
+    if(!this->freeNodeIds.empty()) {
+        node = this->freeNodeIds.back();
+        this->freeNodeIds.pop_back();
+    } else {
+        this->nodeIndices.push_back(UINT32_MAX);
+    }
+    this->nodeIndices[node] = index;
+
+    // Fill Node
+    this->parents[index] = hasParent ? static_cast<int>(parentIndex) : -1;
+    this->subtreeEnds[index] = index + 1;
+    this->nodeIds[index] = node;
+    this->positions[index] = position;
+    this->rotations[index] = rotation;
+    this->scales[index] = scale;
+    this->localBounds[index] = localBounds;
+    this->markDirty(node);
+    return node;
+}
+
+// Remove Node and Its Whole Subtree
+void sgl::SceneGraph::removeNode(const NodeId &node) {
+    if(node >= this->nodeIndices.size() || this->nodeIndices[node] == UINT32_MAX) return;
+    const uint32_t index {this->nodeIndices[node]};
+    const uint32_t count {this->subtreeEnds[index] - index};
+    const int parentIndex {this->parents[index]};
+
+    // Free Node IDs of The Subtree
+    for(uint32_t i {index}; i < index + count; i++) {
+        this->nodeIndices[this->nodeIds[i]] = UINT32_MAX;
+        this->freeNodeIds.push_back(this->nodeIds[i]);
+    }
+
+    // Ancestors' Subtrees Shrink, Then Erase The Range
+    for(int ancestor {parentIndex}; ancestor >= 0; ancestor = this->parents[ancestor]) {
+        this->subtreeEnds[ancestor] -= count;
+    }
+    this->eraseSlots(index, count);
+
+    // The Parent's Subtree Bounds No Longer Include The Removed Nodes
+    if(parentIndex >= 0) this->markDirty(this->nodeIds[parentIndex]);
+}
+
+// Setters - Mark The Node's Subtree Dirty
+void sgl::SceneGraph::setPosition(const NodeId &node, const glm::vec3 &position) {
+    this->positions[this->nodeIndices[node]] = position;
+    this->markDirty(node);
+}
+void sgl::SceneGraph::setRotation(const NodeId &node, const glm::quat &rotation) {
+    this->rotations[this->nodeIndices[node]] = rotation;
+    this->markDirty(node);
+}
+void sgl::SceneGraph::setScale(const NodeId &node, const glm::vec3 &scale) {
+    this->scales[this->nodeIndices[node]] = scale;
+    this->markDirty(node);
+}
+void sgl::SceneGraph::setLocalBounds(const NodeId &node, const AABB &localBounds) {
+    this->localBounds[this->nodeIndices[node]] = localBounds;
+    this->markDirty(node);
+}
+
+// Recompute World Matrices and Bounds of Dirty Subtrees and Subtree Bounds of Their Ancestors - Returns Nodes Recomputed
+size_t sgl::SceneGraph::update(void) {
+    // Dirty Nodes in Index Order - Removed Nodes Are Dropped
+    std::vector<uint32_t> dirtyIndices;
+    dirtyIndices.reserve(this->dirtyNodes.size());
+    for(const NodeId &node : this->dirtyNodes) {
+        if(this->nodeIndices[node] != UINT32_MAX) dirtyIndices.push_back(this->nodeIndices[node]);
+    }
+    this->dirtyNodes.clear();
+    std::sort(dirtyIndices.begin(), dirtyIndices.end());
+
+    // Recompute Each Dirty Subtree Once - Dirty Nodes Inside an Already Recomputed Subtree Are Covered by It
+    size_t numUpdated {0};
+    uint32_t coveredEnd {0};
+    std::vector<uint32_t> ancestors;
+    for(const uint32_t &root : dirtyIndices) {
+        this->dirtyFlags[root] = 0;
+        if(root < coveredEnd) continue;
+        const uint32_t end {this->subtreeEnds[root]};
+        coveredEnd = end;
+
+        // World Matrices and Bounds - Parents Come Before Children in The Range
+        for(uint32_t i {root}; i < end; i++) {
+            const glm::mat4 localMatrix {TransformStore::makeLocalMatrix(this->positions[i], this->rotations[i], this->scales[i])};
+            if(this->parents[i] >= 0) {
+                TransformStore::multiply(this->worldMatrices[this->parents[i]], &localMatrix, &this->worldMatrices[i], 1);
+            } else {
+                this->worldMatrices[i] = localMatrix;
+            }
+            this->worldBounds[i] = this->localBounds[i].transform(this->worldMatrices[i]);
+        }
+
+        // Subtree Bounds - Children Come After Parents, So Walk The Range Backwards
+        for(uint32_t i {end}; i-- > root;) this->updateSubtreeBounds(i);
+        numUpdated += end - root;
+
+        // Ancestors Need Their Subtree Bounds Refreshed
+        for(int ancestor {this->parents[root]}; ancestor >= 0; ancestor = this->parents[ancestor]) {
+            ancestors.push_back(static_cast<uint32_t>(ancestor));
+        }
+    }
+
+    // Refresh Ancestors Deepest First - A Child Always Has a Higher Index Than Its Parent
+    std::sort(ancestors.begin(), ancestors.end(), std::greater<uint32_t>());
+    ancestors.erase(std::unique(ancestors.begin(), ancestors.end()), ancestors.end());
+    for(const uint32_t &ancestor : ancestors) this->updateSubtreeBounds(ancestor);
+    return numUpdated;
+}
+
+// Getters - By Node ID
+const glm::mat4 &sgl::SceneGraph::getWorldMatrix(const NodeId &node) {return this->worldMatrices[this->nodeIndices[node]];}
+const sgl::AABB &sgl::SceneGraph::getWorldBounds(const NodeId &node) {return this->worldBounds[this->nodeIndices[node]];}
+const sgl::AABB &sgl::SceneGraph::getSubtreeBounds(const NodeId &node) {return this->subtreeBounds[this->nodeIndices[node]];}
+glm::vec3 sgl::SceneGraph::getPosition(const NodeId &node) {return this->positions[this->nodeIndices[node]];}
+glm::quat sgl::SceneGraph::getRotation(const NodeId &node) {return this->rotations[this->nodeIndices[node]];}
+glm::vec3 sgl::SceneGraph::getScale(const NodeId &node) {return this->scales[this->nodeIndices[node]];}
+sgl::SceneGraph::NodeId sgl::SceneGraph::getParent(const NodeId &node) {
+    const int parentIndex {this->parents[this->nodeIndices[node]]};
+    return parentIndex >= 0 ? this->nodeIds[parentIndex] : invalidNode;
+}
+
+// Getters - Flat Arrays in Depth-First Order For Culling, The Subtree of Index i Is [i, getSubtreeEnd(i))
+size_t sgl::SceneGraph::getNodeCount(void) {return this->parents.size();}
+uint32_t sgl::SceneGraph::getIndex(const NodeId &node) {return this->nodeIndices[node];}
+sgl::SceneGraph::NodeId sgl::SceneGraph::getNodeId(const uint32_t &index) {return this->nodeIds[index];}
+uint32_t sgl::SceneGraph::getSubtreeEnd(const uint32_t &index) {return this->subtreeEnds[index];}
+const glm::mat4* sgl::SceneGraph::getWorldMatrices(void) {return this->worldMatrices.data();}
+const sgl::AABB* sgl::SceneGraph::getWorldBoundsArray(void) {return this->worldBounds.data();}
+const sgl::AABB* sgl::SceneGraph::getSubtreeBoundsArray(void) {return this->subtreeBounds.data();}
+
+// Insert a Slot in Every Per-Node Array - Later Nodes Shift Up by One
+void sgl::SceneGraph::insertSlot(const uint32_t &index) {
+    this->parents.insert(this->parents.begin() + index, -1);
+    this->subtreeEnds.insert(this->subtreeEnds.begin() + index, index + 1);
+    this->nodeIds.insert(this->nodeIds.begin() + index, invalidNode);
+    this->positions.insert(this->positions.begin() + index, glm::vec3(0.0f));
+    this->rotations.insert(this->rotations.begin() + index, glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+    this->scales.insert(this->scales.begin() + index, glm::vec3(1.0f));
+    this->worldMatrices.insert(this->worldMatrices.begin() + index, glm::mat4(1.0f));
+    this->localBounds.insert(this->localBounds.begin() + index, AABB {});
+    this->worldBounds.insert(this->worldBounds.begin() + index, AABB {});
+    this->subtreeBounds.insert(this->subtreeBounds.begin() + index, AABB {});
+    this->dirtyFlags.insert(this->dirtyFlags.begin() + index, 0);
+
+    // Fix Up Shifted Nodes
+    for(uint32_t i {index + 1}; i < this->parents.size(); i++) {
+        this->subtreeEnds[i]++;
+        if(this->parents[i] >= static_cast<int>(index)) this->parents[i]++;
+        this->nodeIndices[this->nodeIds[i]] = i;
+    }
+}
+
+// Erase Slots From Every Per-Node Array - Later Nodes Shift Down by count
+void sgl::SceneGraph::eraseSlots(const uint32_t &first, const uint32_t &count) {
+    const uint32_t last {first + count};
+    this->parents.erase(this->parents.begin() + first, this->parents.begin() + last);
+    this->subtreeEnds.erase(this->subtreeEnds.begin() + first, this->subtreeEnds.begin() + last);
+    this->nodeIds.erase(this->nodeIds.begin() + first, this->nodeIds.begin() + last);
+    this->positions.erase(this->positions.begin() + first, this->positions.begin() + last);
+    this->rotations.erase(this->rotations.begin() + first, this->rotations.begin() + last);
+    this->scales.erase(this->scales.begin() + first, this->scales.begin() + last);
+    this->worldMatrices.erase(this->worldMatrices.begin() + first, this->worldMatrices.begin() + last);
+    this->localBounds.erase(this->localBounds.begin() + first, this->localBounds.begin() + last);
+    this->worldBounds.erase(this->worldBounds.begin() + first, this->worldBounds.begin() + last);
+    this->subtreeBounds.erase(this->subtreeBounds.begin() + first, this->subtreeBounds.begin() + last);
+    this->dirtyFlags.erase(this->dirtyFlags.begin() + first, this->dirtyFlags.begin() + last);
+
+    // Fix Up Shifted Nodes
+    for(uint32_t i {first}; i < this->parents.size(); i++) {
+        this->subtreeEnds[i] -= count;
+        if(this->parents[i] >= static_cast<int>(last)) this->parents[i] -= count;
+        this->nodeIndices[this->nodeIds[i]] = i;
+    }
+}
+
+// Recompute a Node's Subtree Bounds From Its World Bounds and Its Children's Subtree Bounds
+void sgl::SceneGraph::updateSubtreeBounds(const uint32_t &index) {
+    AABB bounds {this->worldBounds[index]};
+    for(uint32_t child {index + 1}; child < this->subtreeEnds[index]; child = this->subtreeEnds[child]) {
+        bounds.merge(this->subtreeBounds[child]);
+    }
+    this->subtreeBounds[index] = bounds;
+}
+
+// Mark a Node's Subtree Dirty
+void sgl::SceneGraph::markDirty(const NodeId &node) {
+    const uint32_t index {this->nodeIndices[node]};
+    if(this->dirtyFlags[index] & nodeDirty) return;
+    this->dirtyFlags[index] |= nodeDirty;
+    this->dirtyNodes.push_back(node);
+}
@@ -0,0 +1,78 @@
+#include"../Engine.hpp"
+
+// Constructor - permutations[Mask] Is The Desc Function For The Permutation With Those Feature Bits Set, featureNames[Bit] The Define Bit Compiles In
+// With a Shader Reloader, Every Shader and Pipeline Created Is Watched, Recompiled From <shaderName>.glsl With Its Permutation's Defines
+sgl::ShaderRegistry::ShaderRegistry(const std::string &shaderName, const ShaderDescFunc* permutations, const char* const* featureNames, const uint32_t &numPermutations, ShaderReloader* shaderReloader) {
+    this->shaderName = shaderName;
+    for(uint32_t bit {0}; (1u << bit) < numPermutations; bit++) {
+        this->featureNames.push_back(featureNames[bit]);
+    }
+    this->shaderReloader = shaderReloader;
+    this->permutations.assign(permutations, permutations + numPermutations);
+    this->shaders.resize(numPermutations);
+}
+
+// Get Shader For a Permutation - Created on First Use
+sg_shader sgl::ShaderRegistry::getShader(const uint32_t &permutationMask) {
+    // Feature Bits Outside The Generated Set
+    if(permutationMask >= this->permutations.size()) {
+        std::cerr << "Failed to Get Shader Permutation: " << this->shaderName << " Mask " << permutationMask << " Was Not Generated" << std::endl;
+        return {};
+    }
+
+    // Already Created
+    ShaderHandle &shader {this->shaders[permutationMask]};
+    if(shader.get().id != SG_INVALID_ID) {
+        return shader.get();
+    }
+
+    // Create Shader
+    const sg_shader_desc *shaderDesc {this->permutations[permutationMask](sg_query_backend())};
+    if(!shaderDesc) {
+        std::cerr << "Failed to Get Shader Permutation: " << this->shaderName << " Mask " << permutationMask << " Has No Desc For This Backend" << std::endl;
+        return {};
+    }
+    shader = ShaderHandle(sg_make_shader(shaderDesc));
+    this->numShaders++;
+
+    // Watch For Hot Reload - The Program Shares The Shader's Name
+    if(this->shaderReloader) {
+        this->shaderReloader->addShader(shader.get(), this->shaderName + ".glsl", this->shaderName, this->permutations[permutationMask], this->getDefines(permutationMask));
+    }
+    return shader.get();
+}
+
+// Get Pipeline For a Permutation - pipelineDesc Holds The Vertex Layout and Render State, Its Shader Is Filled In
+sg_pipeline sgl::ShaderRegistry::getPipeline(const uint32_t &permutationMask, const sg_pipeline_desc &pipelineDesc) {
+    // The Shader Handle Stands In For The Permutation Mask in The Pipeline Cache's Key
+    sg_pipeline_desc desc {pipelineDesc};
+    desc.shader = this->getShader(permutationMask);
+    if(desc.shader.id == SG_INVALID_ID) {
+        return {};
+    }
+
+    // Get Pipeline - Watched For Hot Reload When It Was Just Created
+    const uint64_t pipelineMisses {this->pipelines.getMisses()};
+    const sg_pipeline pipeline {this->pipelines.get(desc)};
+    if(this->shaderReloader && this->pipelines.getMisses() != pipelineMisses) {
+        this->shaderReloader->addPipeline(pipeline, desc);
+    }
+    return pipeline;
+}
+
+// Getters
+uint32_t sgl::ShaderRegistry::getPermutationCount(void) {return static_cast<uint32_t>(this->permutations.size());}
+uint32_t sgl::ShaderRegistry::getShaderCount(void) {return this->numShaders;}
+uint64_t sgl::ShaderRegistry::getPipelineHits(void) {return this->pipelines.getHits();}
+uint64_t sgl::ShaderRegistry::getPipelineMisses(void) {return this->pipelines.getMisses();}
+
+// Defines For a Permutation - Colon Separated Names of The Features Set in permutationMask, as sokol-shdc's --defines Takes Them
+std::string sgl::ShaderRegistry::getDefines(const uint32_t &permutationMask) {
+    std::string defines;
+    for(uint32_t bit {0}; bit < this->featureNames.size(); bit++) {
+        if(permutationMask & (1u << bit)) {
+            defines += (defines.empty() ? "" : ":") + this->featureNames[bit];
+        }
+    }
+    return defines;
+}
@@ -0,0 +1,303 @@
+#include"../Engine.hpp"
+
+// Standard Headers
+#include<cstdio>
+#include<fstream>
+#include<sstream>
+#include<map>
+
+// POSIX Headers
+#include<poll.h>
+#include<sys/inotify.h>
+#include<unistd.h>
+
+// How Long The Watcher Thread Waits For Events Before Checking Whether It Should Stop (Milliseconds)
+static const int watchPollTimeout {100};
+
+// How Long to Keep Collecting Events After a Change Before Compiling - Editors Often Write a File in Several Steps (Milliseconds)
+static const int changeDebounceTime {50};
+
+// Path of a Shader Stage Written by sokol-shdc's Bare Output Format - {Output}_{Snippet}_{Shader Language}.glsl
+static std::filesystem::path getBareOutputPath(const std::filesystem::path &outputPath, const std::string &snippetName, const std::string &shaderLanguage) {
+    return outputPath.string() + "_" + snippetName + "_" + shaderLanguage + ".glsl";
+}
+
+// Read Whole Text File - Returns False If It Can't Be Opened
+static bool readTextFile(const std::filesystem::path &filePath, std::string &text) {
+    std::ifstream file(filePath);
+    if(!file) {
+        return false;
+    }
+    std::stringstream stream;
+    stream << file.rdbuf();
+    text = stream.str();
+    return true;
+}
+
+// Constructor - Start Watching shaderSrcDirPath, Compiling With The sokol-shdc Binary at shaderCompilerPath
+sgl::ShaderReloader::ShaderReloader(const std::string &shaderSrcDirPath, const std::string &shaderCompilerPath) {
+    // Paths - Compiled Shaders Go to a Scratch Directory So The Checked-In Headers Are Left Alone
+    this->shaderSrcDirPath = shaderSrcDirPath;
+    this->shaderCompilerPath = std::filesystem::absolute(shaderCompilerPath);
+    this->outputDirPath = std::filesystem::temp_directory_path() / "sglShaderReload";
+
+    // Shader Language For The Current Backend - Only Backends That Compile Shader Source at Runtime Can Reload
+    switch(sg_query_backend()) {
+        case SG_BACKEND_GLCORE33:
+            this->shaderLanguage = "glsl330";
+            break;
+        case SG_BACKEND_GLES3:
+            this->shaderLanguage = "glsl300es";
+            break;
+        default:
+            std::cerr << "Failed to Start Shader Reloader: Only The OpenGL Backends Support Shader Hot Reload" << std::endl;
+            return;
+    }
+
+    // Create Output Directory
+    std::error_code error;
+    std::filesystem::create_directories(this->outputDirPath, error);
+    if(error) {
+        std::cerr << "Failed to Create Shader Reload Directory: " << this->outputDirPath << std::endl;
+        return;
+    }
+
+    // Watch Shader Source Directory - Files Written in Place or Moved Over (Editors That Save Atomically)
+    this->inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(this->inotifyFd < 0) {
+        std::cerr << "Failed to Initialize inotify" << std::endl;
+        return;
+    }
+    if(inotify_add_watch(this->inotifyFd, this->shaderSrcDirPath.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "Failed to Watch Shader Source Directory: " << this->shaderSrcDirPath << std::endl;
+        close(this->inotifyFd);
+        this->inotifyFd = -1;
+        return;
+    }
+
+    // Start Watcher Thread
+    this->watcher = std::thread(&sgl::ShaderReloader::watcherMain, this);
+}
+
+// Destructor - Stop Watcher Thread
+sgl::ShaderReloader::~ShaderReloader(void) {
+    // Join Watcher Thread - It Checks The Flag Every Poll Timeout
+    this->stopping = true;
+    if(this->watcher.joinable()) {
+        this->watcher.join();
+    }
+
+    // Close inotify Descriptor
+    if(this->inotifyFd >= 0) {
+        close(this->inotifyFd);
+    }
+}
+
+// Watch Shader - Program programName in shaderSrcFileName, shaderDescFunc Is The Function sokol-shdc Generated For It
+// defines Are The Colon Separated Defines It Was Compiled With (a Shader Permutation), Passed to sokol-shdc as --defines
+void sgl::ShaderReloader::addShader(const sg_shader &shader, const std::string &shaderSrcFileName, const std::string &programName, const sg_shader_desc* (*shaderDescFunc)(sg_backend), const std::string &defines) {
+    // Compiled-In Desc - Its Reflection Is Reused, Only The Shader Source Gets Replaced
+    const sg_shader_desc *shaderDesc {shaderDescFunc(sg_query_backend())};
+    if(!shaderDesc) {
+        std::cerr << "Failed to Watch Shader: No Desc For Program " << programName << " on This Backend" << std::endl;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->watchedMutex);
+    this->watchedShaders.push_back(WatchedShader {shader, shaderSrcFileName, programName, defines, *shaderDesc});
+}
+
+// Watch Pipeline - Rebuilt From pipelineDesc Whenever Its Shader Reloads
+void sgl::ShaderReloader::addPipeline(const sg_pipeline &pipeline, const sg_pipeline_desc &pipelineDesc) {
+    // Pipeline Caches Hand Out The Same Handle For Identical Descs - Watch Each Pipeline Once
+    for(const WatchedPipeline &watchedPipeline : this->watchedPipelines) {
+        if(watchedPipeline.pipeline.id == pipeline.id) {
+            return;
+        }
+    }
+    this->watchedPipelines.push_back(WatchedPipeline {pipeline, pipelineDesc});
+}
+
+// Swap In Recompiled Shaders - Call Once Per Frame Outside Render Passes, Returns The Number of Shaders Reloaded
+int sgl::ShaderReloader::update(void) {
+    // Take Compiled Programs
+    std::vector<CompiledProgram> compiledPrograms;
+    {
+        std::lock_guard<std::mutex> lock(this->compiledMutex);
+        compiledPrograms.swap(this->compiledPrograms);
+    }
+    if(compiledPrograms.empty()) {
+        return 0;
+    }
+
+    // Swap In Each Program
+    int numReloaded {0};
+    std::lock_guard<std::mutex> lock(this->watchedMutex);
+    for(const CompiledProgram &compiledProgram : compiledPrograms) {
+        for(const WatchedShader &watchedShader : this->watchedShaders) {
+            if(watchedShader.shaderSrcFileName != compiledProgram.shaderSrcFileName || watchedShader.programName != compiledProgram.programName ||
+               watchedShader.defines != compiledProgram.defines) {
+                continue;
+            }
+
+            // Compiled-In Desc With The New Source
+            sg_shader_desc shaderDesc {watchedShader.shaderDesc};
+            shaderDesc.vs.source = compiledProgram.vsSource.c_str();
+            shaderDesc.fs.source = compiledProgram.fsSource.c_str();
+
+            // Try The New Shader on Its Own First - The Driver Can Still Reject What sokol-shdc Accepted, Keep The Old Shader Then
+            sg_shader testShader {sg_make_shader(&shaderDesc)};
+            const bool isValid {sg_query_shader_state(testShader) == SG_RESOURCESTATE_VALID};
+            sg_destroy_shader(testShader);
+            if(!isValid) {
+                std::cerr << "Failed to Reload Shader: " << compiledProgram.programName << " [" << compiledProgram.defines << "] Was Rejected by The Driver, Keeping The Old One" << std::endl;
+                continue;
+            }
+
+            // Release Pipelines Using The Shader
+            for(const WatchedPipeline &watchedPipeline : this->watchedPipelines) {
+                if(watchedPipeline.pipelineDesc.shader.id == watchedShader.shader.id) {
+                    sg_uninit_pipeline(watchedPipeline.pipeline);
+                }
+            }
+
+            // Rebuild Shader in Place - Every Handle Held by The Renderer Stays Valid
+            sg_uninit_shader(watchedShader.shader);
+            sg_init_shader(watchedShader.shader, &shaderDesc);
+
+            // Rebuild Pipelines in Place
+            for(const WatchedPipeline &watchedPipeline : this->watchedPipelines) {
+                if(watchedPipeline.pipelineDesc.shader.id == watchedShader.shader.id) {
+                    sg_init_pipeline(watchedPipeline.pipeline, &watchedPipeline.pipelineDesc);
+                    if(sg_query_pipeline_state(watchedPipeline.pipeline) != SG_RESOURCESTATE_VALID) {
+                        std::cerr << "Failed to Rebuild Pipeline For Shader: " << compiledProgram.programName << " [" << compiledProgram.defines << "]" << std::endl;
+                    }
+                }
+            }
+
+            // Report Time From Saving The Source to The New Shader Being Live
+            const std::chrono::duration<double, std::milli> reloadTime {std::chrono::steady_clock::now() - compiledProgram.changeTime};
+            std::cout << "Reloaded Shader: " << compiledProgram.programName << " [" << compiledProgram.defines << "] (" << reloadTime.count() << " ms)" << std::endl;
+            numReloaded++;
+        }
+    }
+    return numReloaded;
+}
+
+// Watcher Thread Main Loop
+void sgl::ShaderReloader::watcherMain(void) {
+    // Event Buffer - Aligned For inotify_event
+    alignas(inotify_event) char eventBuffer[4096];
+    pollfd pollFd {this->inotifyFd, POLLIN, 0};
+    while(!this->stopping) {
+        // Wait For Changes
+        if(poll(&pollFd, 1, watchPollTimeout) <= 0) {
+            continue;
+        }
+        const std::chrono::steady_clock::time_point changeTime {std::chrono::steady_clock::now()};
+
+        // Collect Changed File Names Until Things Settle Down
+        std::set<std::string> changedFileNames;
+        do {
+            ssize_t numBytes;
+            while((numBytes = read(this->inotifyFd, eventBuffer, sizeof(eventBuffer))) > 0) {
+                for(ssize_t offset {0}; offset < numBytes;) {
+                    const inotify_event *event {reinterpret_cast<const inotify_event*>(eventBuffer + offset)};
+                    if(event->len > 0) {
+                        changedFileNames.insert(event->name);
+                    }
+                    offset += sizeof(inotify_event) + event->len;
+                }
+            }
+        } while(poll(&pollFd, 1, changeDebounceTime) > 0);
+
+        // Compile Changed Files
+        for(const std::string &changedFileName : changedFileNames) {
+            this->compile(changedFileName, changeTime);
+        }
+    }
+}
+
+// Compile a Changed Shader Source File and Queue Its Watched Programs - Once Per Set of Defines Watched Programs Use
+void sgl::ShaderReloader::compile(const std::string &shaderSrcFileName, const std::chrono::steady_clock::time_point &changeTime) {
+    // Only Compile Files With Watched Programs, Grouped by Defines
+    std::map<std::string, std::set<std::string>> programNamesByDefines;
+    {
+        std::lock_guard<std::mutex> lock(this->watchedMutex);
+        for(const WatchedShader &watchedShader : this->watchedShaders) {
+            if(watchedShader.shaderSrcFileName == shaderSrcFileName) {
+                programNamesByDefines[watchedShader.defines].insert(watchedShader.programName);
+            }
+        }
+    }
+
+    // Compile Each Set of Defines
+    for(const auto &[defines, programNames] : programNamesByDefines) {
+        this->compile(shaderSrcFileName, defines, programNames, changeTime);
+    }
+}
+
+// Compile a Shader Source File With One Set of Defines and Queue Its Watched Programs
+void sgl::ShaderReloader::compile(const std::string &shaderSrcFileName, const std::string &defines, const std::set<std::string> &programNames, const std::chrono::steady_clock::time_point &changeTime) {
+    // Output Path - Each Set of Defines Gets Its Own, So Permutations Don't Overwrite Each Other's Stages
+    std::string outputName {std::filesystem::path(shaderSrcFileName).stem().string()};
+    if(!defines.empty()) {
+        std::string definesName {defines};
+        std::replace(definesName.begin(), definesName.end(), ':', '_');
+        outputName += "_" + definesName;
+    }
+    const std::filesystem::path outputPath {this->outputDirPath / outputName};
+
+    // Compile With sokol-shdc - Bare Output Writes Each Stage as Plain Shader Source
+    const std::filesystem::path shaderSrcFilePath {this->shaderSrcDirPath / shaderSrcFileName};
+    const std::string command {
+        "\"" + this->shaderCompilerPath.string() + "\" -i \"" + shaderSrcFilePath.string() + "\" -o \"" + outputPath.string() +
+        "\" -l " + this->shaderLanguage + " -f bare" + (defines.empty() ? "" : " --defines=" + defines) + " 2>&1"
+    };
+    FILE *compiler {popen(command.c_str(), "r")};
+    if(!compiler) {
+        std::cerr << "Failed to Run Shader Compiler: " << this->shaderCompilerPath << std::endl;
+        return;
+    }
+    std::string compilerOutput;
+    char line[512];
+    while(fgets(line, sizeof(line), compiler)) {
+        compilerOutput += line;
+    }
+    if(pclose(compiler) != 0) {
+        std::cerr << "Failed to Compile Shader: " << shaderSrcFileName << " [" << defines << "], Keeping The Old One\n" << compilerOutput << std::endl;
+        return;
+    }
+
+    // Stage Snippet Names For Each Program - Read From The Source's @program Lines
+    std::string shaderSrc;
+    if(!readTextFile(shaderSrcFilePath, shaderSrc)) {
+        std::cerr << "Failed to Read Shader Source: " << shaderSrcFilePath << std::endl;
+        return;
+    }
+    std::vector<CompiledProgram> compiledPrograms;
+    std::istringstream shaderSrcStream(shaderSrc);
+    std::string srcLine;
+    while(std::getline(shaderSrcStream, srcLine)) {
+        std::istringstream lineStream(srcLine);
+        std::string tag, programName, vsName, fsName;
+        if(!(lineStream >> tag >> programName >> vsName >> fsName) || tag != "@program" || !programNames.count(programName)) {
+            continue;
+        }
+
+        // Read Compiled Stages
+        CompiledProgram compiledProgram {shaderSrcFileName, programName, defines, "", "", changeTime};
+        if(!readTextFile(getBareOutputPath(outputPath, vsName, this->shaderLanguage), compiledProgram.vsSource) ||
+           !readTextFile(getBareOutputPath(outputPath, fsName, this->shaderLanguage), compiledProgram.fsSource)) {
+            std::cerr << "Failed to Read Compiled Shader: " << programName << std::endl;
+            continue;
+        }
+        compiledPrograms.push_back(std::move(compiledProgram));
+    }
+
+    // Queue For The Main Thread
+    std::lock_guard<std::mutex> lock(this->compiledMutex);
+    for(CompiledProgram &compiledProgram : compiledPrograms) {
+        this->compiledPrograms.push_back(std::move(compiledProgram));
+    }
+}
@@ -0,0 +1,149 @@
+#include"../Engine.hpp"
+
+// Shape Kinds - Part of Each Shape's Cache Key
+static const uint32_t shapePlane {0}, shapeBox {1}, shapeSphere {2}, shapeCylinder {3}, shapeTorus {4};
+
+// Constructor - Create Dynamic Vertex and Index Buffers Holding Up to maxVertices (At Most 65536, Indices Are 16-Bit) and maxIndices
+sgl::ShapeCache::ShapeCache(const int &maxVertices, const int &maxIndices) {
+    this->vertices.resize(static_cast<size_t>(std::min(maxVertices, 65536)));
+    this->indices.resize(static_cast<size_t>(maxIndices));
+
+    // Create Dynamic Vertex and Index Buffers
+    sg_buffer_desc vertexBufferDesc {};
+    vertexBufferDesc.type = SG_BUFFERTYPE_VERTEXBUFFER;
+    vertexBufferDesc.usage = SG_USAGE_DYNAMIC;
+    vertexBufferDesc.size = this->vertices.size() * sizeof(sshape_vertex_t);
+    this->vertexBuffer = BufferHandle(sg_make_buffer(&vertexBufferDesc));
+
+    sg_buffer_desc indexBufferDesc {};
+    indexBufferDesc.type = SG_BUFFERTYPE_INDEXBUFFER;
+    indexBufferDesc.usage = SG_USAGE_DYNAMIC;
+    indexBufferDesc.size = this->indices.size() * sizeof(uint16_t);
+    this->indexBuffer = BufferHandle(sg_make_buffer(&indexBufferDesc));
+}
+
+// Shape Key Comparison and Hash - Keys Have No Padding, So Their Bytes Identify Them
+bool sgl::ShapeCache::ShapeKey::operator==(const ShapeKey &other) const {return std::memcmp(this, &other, sizeof(ShapeKey)) == 0;}
+size_t sgl::ShapeCache::ShapeKeyHash::operator()(const ShapeKey &key) const {return static_cast<size_t>(hashBytes(&key, sizeof(key)));}
+
+// Get Shape's Element Range - Generated on First Request, No Elements When The Cache Is Full
+// Subdivision Counts Are Clamped to The Smallest That Still Close The Shape
+sshape_element_range_t sgl::ShapeCache::getPlane(const float &width, const float &depth, const uint16_t &tiles) {
+    const ShapeKey key {shapePlane, {width, depth, 0.0f}, {std::max<uint16_t>(tiles, 1), 0}};
+    return this->addShape(key, sshape_plane_sizes(key.divisions[0]), [&](const sshape_buffer_t &buffer) {
+        sshape_plane_t plane {};
+        plane.width = key.sizes[0];
+        plane.depth = key.sizes[1];
+        plane.tiles = key.divisions[0];
+        return sshape_build_plane(&buffer, &plane);
+    });
+}
+sshape_element_range_t sgl::ShapeCache::getBox(const float &width, const float &height, const float &depth, const uint16_t &tiles) {
+    const ShapeKey key {shapeBox, {width, height, depth}, {std::max<uint16_t>(tiles, 1), 0}};
+    return this->addShape(key, sshape_box_sizes(key.divisions[0]), [&](const sshape_buffer_t &buffer) {
+        sshape_box_t box {};
+        box.width = key.sizes[0];
+        box.height = key.sizes[1];
+        box.depth = key.sizes[2];
+        box.tiles = key.divisions[0];
+        return sshape_build_box(&buffer, &box);
+    });
+}
+sshape_element_range_t sgl::ShapeCache::getSphere(const float &radius, const uint16_t &slices, const uint16_t &stacks) {
+    const ShapeKey key {shapeSphere, {radius, 0.0f, 0.0f}, {std::max<uint16_t>(slices, 3), std::max<uint16_t>(stacks, 2)}};
+    return this->addShape(key, sshape_sphere_sizes(key.divisions[0], key.divisions[1]), [&](const sshape_buffer_t &buffer) {
+        sshape_sphere_t sphere {};
+        sphere.radius = key.sizes[0];
+        sphere.slices = key.divisions[0];
+        sphere.stacks = key.divisions[1];
+        return sshape_build_sphere(&buffer, &sphere);
+    });
+}
+sshape_element_range_t sgl::ShapeCache::getCylinder(const float &radius, const float &height, const uint16_t &slices, const uint16_t &stacks) {
+    const ShapeKey key {shapeCylinder, {radius, height, 0.0f}, {std::max<uint16_t>(slices, 3), std::max<uint16_t>(stacks, 1)}};
+    return this->addShape(key, sshape_cylinder_sizes(key.divisions[0], key.divisions[1]), [&](const sshape_buffer_t &buffer) {
+        sshape_cylinder_t cylinder {};
+        cylinder.radius = key.sizes[0];
+        cylinder.height = key.sizes[1];
+        cylinder.slices = key.divisions[0];
+        cylinder.stacks = key.divisions[1];
+        return sshape_build_cylinder(&buffer, &cylinder);
+    });
+}
+sshape_element_range_t sgl::ShapeCache::getTorus(const float &radius, const float &ringRadius, const uint16_t &sides, const uint16_t &rings) {
+    const ShapeKey key {shapeTorus, {radius, ringRadius, 0.0f}, {std::max<uint16_t>(sides, 3), std::max<uint16_t>(rings, 3)}};
+    return this->addShape(key, sshape_torus_sizes(key.divisions[0], key.divisions[1]), [&](const sshape_buffer_t &buffer) {
+        sshape_torus_t torus {};
+        torus.radius = key.sizes[0];
+        torus.ring_radius = key.sizes[1];
+        torus.sides = key.divisions[0];
+        torus.rings = key.divisions[1];
+        return sshape_build_torus(&buffer, &torus);
+    });
+}
+
+// Add Shape - Return The Cached Range For key, Otherwise Build It Into The Shared Vertex and Index Data
+sshape_element_range_t sgl::ShapeCache::addShape(const ShapeKey &key, const sshape_sizes_t &sizes, const std::function<sshape_buffer_t(const sshape_buffer_t&)> &buildShape) {
+    // Look Up Shape
+    const auto cachedShape {this->shapes.find(key)};
+    if(cachedShape != this->shapes.end()) return cachedShape->second;
+
+    // Check The Shape Fits
+    if(this->vertexCount + sizes.vertices.num > this->vertices.size() || this->indexCount + sizes.indices.num > this->indices.size()) {
+        std::cerr << "Failed to Add Shape - Shape Cache Is Full" << std::endl;
+        return {0, 0};
+    }
+
+    // Build Shape After The Shapes Already in The Buffers - sokol_shape Offsets Its Indices by The Vertices Already There
+    sshape_buffer_t buffer {};
+    buffer.vertices.buffer = {this->vertices.data(), this->vertices.size() * sizeof(sshape_vertex_t)};
+    buffer.vertices.data_size = this->vertexCount * sizeof(sshape_vertex_t);
+    buffer.indices.buffer = {this->indices.data(), this->indices.size() * sizeof(uint16_t)};
+    buffer.indices.data_size = this->indexCount * sizeof(uint16_t);
+    buffer = buildShape(buffer);
+    if(!buffer.valid) {
+        std::cerr << "Failed to Build Shape" << std::endl;
+        return {0, 0};
+    }
+    this->vertexCount = buffer.vertices.data_size / sizeof(sshape_vertex_t);
+    this->indexCount = buffer.indices.data_size / sizeof(uint16_t);
+    this->dirty = true;
+
+    // Cache Shape's Element Range
+    const sshape_element_range_t elementRange {sshape_element_range(&buffer)};
+    this->shapes.emplace(key, elementRange);
+    return elementRange;
+}
+
+// Upload Shapes Generated Since The Last Upload - At Most Once Per Frame (Sokol Allows One Update Per Buffer Per Frame), Before Drawing Them
+void sgl::ShapeCache::upload(void) {
+    if(!this->dirty) return;
+    sg_update_buffer(this->vertexBuffer.get(), {this->vertices.data(), this->vertexCount * sizeof(sshape_vertex_t)});
+    sg_update_buffer(this->indexBuffer.get(), {this->indices.data(), this->indexCount * sizeof(uint16_t)});
+    this->dirty = false;
+}
+
+// Set Up a Pipeline Desc For Shape Vertices in bufferIndex and 16-Bit Indices - Attribute Slots of -1 Are Skipped
+void sgl::ShapeCache::setLayout(sg_pipeline_desc &pipelineDesc, const int &bufferIndex, const int &positionAttr, const int &normalAttr, const int &texCoordAttr, const int &colorAttr) {
+    // sokol_shape's Attribute States Carry Explicit Offsets, So Other Buffers in The Pipeline Need Explicit Offsets Too
+    pipelineDesc.layout.buffers[bufferIndex] = sshape_vertex_buffer_layout_state();
+    const std::pair<int, sg_vertex_attr_state> attrs[] {
+        {positionAttr, sshape_position_vertex_attr_state()},
+        {normalAttr, sshape_normal_vertex_attr_state()},
+        {texCoordAttr, sshape_texcoord_vertex_attr_state()},
+        {colorAttr, sshape_color_vertex_attr_state()},
+    };
+    for(const auto &[attrSlot, attrState] : attrs) {
+        if(attrSlot < 0) continue;
+        pipelineDesc.layout.attrs[attrSlot] = attrState;
+        pipelineDesc.layout.attrs[attrSlot].buffer_index = bufferIndex;
+    }
+    pipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+}
+
+// Getters
+sg_buffer sgl::ShapeCache::getVertexBuffer(void) {return this->vertexBuffer.get();}
+sg_buffer sgl::ShapeCache::getIndexBuffer(void) {return this->indexBuffer.get();}
+size_t sgl::ShapeCache::getShapeCount(void) {return this->shapes.size();}
+int sgl::ShapeCache::getVertexCount(void) {return static_cast<int>(this->vertexCount);}
+int sgl::ShapeCache::getIndexCount(void) {return static_cast<int>(this->indexCount);}
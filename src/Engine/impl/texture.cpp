@@ -2,6 +2,18 @@
 
 // Constructor - Load Texture Image File and Create Texture Object
 sgl::Texture::Texture(sg_image_desc &imgDesc, const std::string &texImgFilePath) {
+    // Cooked Texture Blob - Map It and Hand Its Mip Levels Straight to Sokol
+    if(isTextureBlob(texImgFilePath)) {
+        MappedFile texBlob(texImgFilePath);
+        std::vector<uint8_t> texBlobFallback;
+        if(loadTextureBlob(texBlob, imgDesc, texBlobFallback, !canSampleBlockFormats())) {
+            this->texture = ImageHandle(sg_make_image(imgDesc));
+        } else {
+            std::cerr << "Failed to Load Texture Blob File: " << texImgFilePath << std::endl;
+        }
+        return;
+    }
+
     // Flip Texture Images Vertically Upon Loading Them
     stbi_set_flip_vertically_on_load(true);
 
@@ -16,7 +28,7 @@ sgl::Texture::Texture(sg_image_desc &imgDesc, const std::string &texImgFilePath)
         imgDesc.data.subimage[0][0].size = texWidth * texHeight * 4;
 
         // Create Texture Object
-        this->texture = sg_make_image(imgDesc);
+        this->texture = ImageHandle(sg_make_image(imgDesc));
     } else {
         // Display Error Message
         std::cerr << "Failed to Load Texture Image File: " << texImgFilePath << std::endl;
@@ -26,5 +38,91 @@ sgl::Texture::Texture(sg_image_desc &imgDesc, const std::string &texImgFilePath)
     stbi_image_free(texImg);
 }
 
+// Constructor - Queue Texture Image File on a Texture Loader and Use Its Placeholder Until Loaded
+sgl::Texture::Texture(TextureLoader &texLoader, const sg_image_desc &imgDesc, const std::string &texImgFilePath) {
+    this->texture = ImageHandle(texLoader.load(imgDesc, texImgFilePath));
+}
+
 // Getters
-sg_image sgl::Texture::getImage(void) {return this->texture;}
+sg_image sgl::Texture::getImage(void) {return this->texture.get();}
+
+// Estimated GPU Memory Used by an Image - Every Mip Level of Every Face/Layer
+size_t sgl::getImageByteSize(const sg_image_desc &imgDesc) {
+    const int numSlices {imgDesc.type == SG_IMAGETYPE_CUBE ? 6 : std::max(imgDesc.num_slices, 1)};
+    const int numMipmaps {std::max(imgDesc.num_mipmaps, 1)};
+    size_t byteSize {0};
+    for(int mip {0}; mip < numMipmaps; mip++) {
+        const int mipWidth {std::max(imgDesc.width >> mip, 1)}, mipHeight {std::max(imgDesc.height >> mip, 1)};
+        byteSize += static_cast<size_t>(sg_query_surface_pitch(imgDesc.pixel_format, mipWidth, mipHeight, 1)) * numSlices;
+    }
+    return byteSize;
+}
+
+// Point Image Desc at a Mapped Texture Blob's Mip Levels - No Copy or Decode, Returns False if The Blob Is Invalid
+bool sgl::loadTextureBlob(MappedFile &texBlob, sg_image_desc &imgDesc, std::vector<uint8_t> &fallbackData, const bool &decompressBlockFormats) {
+    // Validate Header
+    if(!texBlob.isOpen() || texBlob.getSize() < sizeof(TextureBlobHeader)) return false;
+    TextureBlobHeader header;
+    std::memcpy(&header, texBlob.getData(), sizeof(header));
+    if(std::memcmp(header.magic, textureBlobMagic, sizeof(header.magic)) != 0 || header.version != textureBlobVersion) return false;
+    if(header.numMipmaps < 1 || header.numMipmaps > SG_MAX_MIPMAPS) return false;
+    if(header.width < 1 || header.width > textureBlobMaxSize || header.height < 1 || header.height > textureBlobMaxSize) return false;
+    // A Full Mip Chain Has 1 + floor(log2(Largest Side)) Levels, Which Is The Bit Width of The Largest Side
+    if(header.numMipmaps > static_cast<uint32_t>(std::bit_width(std::max(header.width, header.height)))) {
+        std::cerr << "Texture Blob Has More Mip Levels Than Its Size Allows: " << header.numMipmaps << " For " << header.width << "x" << header.height << std::endl;
+        return false;
+    }
+    if(header.pixelFormat <= SG_PIXELFORMAT_NONE || header.pixelFormat >= _SG_PIXELFORMAT_NUM) return false;
+    for(uint32_t mip {0}; mip < header.numMipmaps; mip++) {
+        // Written So It Cannot Wrap Around on Overflow
+        if(header.mipSizes[mip] > texBlob.getSize() || header.mipOffsets[mip] > texBlob.getSize() - header.mipSizes[mip]) return false;
+    }
+    const sg_pixel_format pixelFormat {static_cast<sg_pixel_format>(header.pixelFormat)};
+    imgDesc.width = static_cast<int>(header.width);
+    imgDesc.height = static_cast<int>(header.height);
+    imgDesc.num_mipmaps = static_cast<int>(header.numMipmaps);
+
+    // Block Compressed Format The Backend Cannot Sample - Decompress Every Mip Level to RGBA8
+    if(decompressBlockFormats && isBlockCompressedFormat(pixelFormat)) {
+        // Mip Level Dimensions and Offsets Within The Fallback Data
+        size_t fallbackSize {0};
+        size_t mipOffsets[SG_MAX_MIPMAPS];
+        for(uint32_t mip {0}; mip < header.numMipmaps; mip++) {
+            const int mipWidth {std::max(imgDesc.width >> mip, 1)}, mipHeight {std::max(imgDesc.height >> mip, 1)};
+            if(header.mipSizes[mip] < getBlockCompressedSize(pixelFormat, mipWidth, mipHeight)) return false;
+            mipOffsets[mip] = fallbackSize;
+            fallbackSize += static_cast<size_t>(mipWidth) * mipHeight * 4;
+        }
+
+        // Decompress Mip Levels
+        fallbackData.resize(fallbackSize);
+        for(uint32_t mip {0}; mip < header.numMipmaps; mip++) {
+            const int mipWidth {std::max(imgDesc.width >> mip, 1)}, mipHeight {std::max(imgDesc.height >> mip, 1)};
+            decompressBlockImage(texBlob.getData() + header.mipOffsets[mip], pixelFormat, mipWidth, mipHeight, fallbackData.data() + mipOffsets[mip]);
+            imgDesc.data.subimage[0][mip].ptr = fallbackData.data() + mipOffsets[mip];
+            imgDesc.data.subimage[0][mip].size = static_cast<size_t>(mipWidth) * mipHeight * 4;
+        }
+        imgDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+        return true;
+    }
+
+    // Point Every Mip Level at The Mapped Pixel Data - Each Must Hold at Least a Full Mip Level of Its Format
+    for(uint32_t mip {0}; mip < header.numMipmaps; mip++) {
+        const int mipWidth {std::max(imgDesc.width >> mip, 1)}, mipHeight {std::max(imgDesc.height >> mip, 1)};
+        if(header.mipSizes[mip] < static_cast<uint64_t>(sg_query_surface_pitch(pixelFormat, mipWidth, mipHeight, 1))) return false;
+        imgDesc.data.subimage[0][mip].ptr = texBlob.getData() + header.mipOffsets[mip];
+        imgDesc.data.subimage[0][mip].size = header.mipSizes[mip];
+    }
+    imgDesc.pixel_format = pixelFormat;
+    return true;
+}
+
+// Check if a Texture Image File Path Refers to a Cooked Texture Blob
+bool sgl::isTextureBlob(const std::string &texImgFilePath) {
+    return std::filesystem::path(texImgFilePath).extension() == textureBlobExtension;
+}
+
+// Check if The Backend Can Sample Both Block Compressed Formats
+bool sgl::canSampleBlockFormats(void) {
+    return sg_query_pixelformat(SG_PIXELFORMAT_BC1_RGBA).sample && sg_query_pixelformat(SG_PIXELFORMAT_BC3_RGBA).sample;
+}
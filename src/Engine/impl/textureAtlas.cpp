@@ -0,0 +1,121 @@
+#include"../Engine.hpp"
+
+// Constructor - Set Atlas Page Size and Padding Around Each Sprite (Filled by Extruding Its Edges)
+sgl::TextureAtlas::TextureAtlas(const int &pageSize, const int &padding) {
+    this->pageSize = pageSize;
+    this->padding = padding;
+}
+
+// Add Texture Image File - Returns The Sprite Index
+int sgl::TextureAtlas::addImage(const std::string &texImgFilePath) {
+    // Flip Texture Images Vertically Upon Loading Them
+    stbi_set_flip_vertically_on_load(true);
+
+    // Load Texture Image File
+    int texWidth, texHeight, texNrChannels;
+    stbi_uc* texImg {stbi_load(texImgFilePath.c_str(), &texWidth, &texHeight, &texNrChannels, 4)};
+    if(!texImg) {
+        // Display Error Message - The Sprite Is Added Empty and Never Packed
+        std::cerr << "Failed to Load Texture Image File: " << texImgFilePath << std::endl;
+        return this->addPixels(nullptr, 0, 0);
+    }
+
+    // Add Pixels and Free Texture Image Data From Memory
+    const int spriteIndex {this->addPixels(texImg, texWidth, texHeight)};
+    stbi_image_free(texImg);
+    return spriteIndex;
+}
+
+// Add RGBA8 Pixels - Returns The Sprite Index
+int sgl::TextureAtlas::addPixels(const uint8_t* pixels, const int &width, const int &height) {
+    SourceImage sourceImage;
+    if(pixels) sourceImage.pixels.assign(pixels, pixels + static_cast<size_t>(width) * height * 4);
+    sourceImage.width = pixels ? width : 0;
+    sourceImage.height = pixels ? height : 0;
+    this->sourceImages.push_back(std::move(sourceImage));
+    this->sprites.emplace_back();
+    return static_cast<int>(this->sprites.size()) - 1;
+}
+
+// Pack Every Added Image Into Atlas Pages and Create a Texture Image Per Page
+void sgl::TextureAtlas::build(const sg_image_desc &imgDesc) {
+    // Padded Rects For Every Image That Can Fit in a Page
+    std::vector<stbrp_rect> rects;
+    for(size_t i {0}; i < this->sourceImages.size(); i++) {
+        const SourceImage &sourceImage {this->sourceImages[i]};
+        if(sourceImage.pixels.empty()) continue;
+        stbrp_rect rect {};
+        rect.id = static_cast<int>(i);
+        rect.w = sourceImage.width + this->padding * 2;
+        rect.h = sourceImage.height + this->padding * 2;
+        if(rect.w > this->pageSize || rect.h > this->pageSize) {
+            std::cerr << "Texture Atlas Image Larger Than Atlas Page: " << sourceImage.width << "x" << sourceImage.height << std::endl;
+            continue;
+        }
+        rects.push_back(rect);
+    }
+
+    // Fill Pages Until Every Rect Is Packed - Each Pass Packs As Many of The Remaining Rects As Fit
+    std::vector<stbrp_node> nodes(static_cast<size_t>(this->pageSize));
+    std::vector<uint8_t> pagePixels(static_cast<size_t>(this->pageSize) * this->pageSize * 4);
+    while(!rects.empty()) {
+        stbrp_context context;
+        stbrp_init_target(&context, this->pageSize, this->pageSize, nodes.data(), static_cast<int>(nodes.size()));
+        stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()));
+
+        // Copy Packed Images Into The Page, Extruding Their Edges Into The Padding
+        const int page {static_cast<int>(this->pages.size())};
+        std::fill(pagePixels.begin(), pagePixels.end(), 0);
+        std::vector<stbrp_rect> remainingRects;
+        for(const stbrp_rect &rect : rects) {
+            if(!rect.was_packed) {
+                remainingRects.push_back(rect);
+                continue;
+            }
+            const SourceImage &sourceImage {this->sourceImages[static_cast<size_t>(rect.id)]};
+            for(int y {0}; y < rect.h; y++) {
+                const int sourceY {std::clamp(y - this->padding, 0, sourceImage.height - 1)};
+                for(int x {0}; x < rect.w; x++) {
+                    const int sourceX {std::clamp(x - this->padding, 0, sourceImage.width - 1)};
+                    std::memcpy(pagePixels.data() + (static_cast<size_t>(rect.y + y) * this->pageSize + rect.x + x) * 4,
+                                sourceImage.pixels.data() + (static_cast<size_t>(sourceY) * sourceImage.width + sourceX) * 4, 4);
+                }
+            }
+
+            // Sprite UV Rect - Excludes The Padding
+            Sprite &sprite {this->sprites[static_cast<size_t>(rect.id)]};
+            sprite.page = page;
+            sprite.uvMin = glm::vec2(rect.x + this->padding, rect.y + this->padding) / static_cast<float>(this->pageSize);
+            sprite.uvMax = glm::vec2(rect.x + this->padding + sourceImage.width, rect.y + this->padding + sourceImage.height) / static_cast<float>(this->pageSize);
+        }
+
+        // Create Atlas Page Image
+        sg_image_desc pageDesc {imgDesc};
+        pageDesc.width = this->pageSize;
+        pageDesc.height = this->pageSize;
+        pageDesc.num_mipmaps = 1;
+        pageDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+        pageDesc.data.subimage[0][0].ptr = pagePixels.data();
+        pageDesc.data.subimage[0][0].size = pagePixels.size();
+        this->pages.emplace_back(sg_make_image(pageDesc));
+        rects = std::move(remainingRects);
+    }
+
+    // Source Images Are No Longer Needed
+    this->sourceImages.clear();
+}
+
+// Rewrite Sprite Space [0, 1] Texture Coordinates of Interleaved Float Vertices to Atlas Space
+void sgl::TextureAtlas::remapTexCoords(const int &spriteIndex, float* vertices, const size_t &numVertices, const size_t &stride, const size_t &texCoordOffset) {
+    const Sprite &sprite {this->sprites[static_cast<size_t>(spriteIndex)]};
+    for(size_t i {0}; i < numVertices; i++) {
+        float* texCoords {vertices + i * stride + texCoordOffset};
+        texCoords[0] = sprite.uvMin.x + texCoords[0] * (sprite.uvMax.x - sprite.uvMin.x);
+        texCoords[1] = sprite.uvMin.y + texCoords[1] * (sprite.uvMax.y - sprite.uvMin.y);
+    }
+}
+
+// Getters
+const sgl::TextureAtlas::Sprite &sgl::TextureAtlas::getSprite(const int &spriteIndex) {return this->sprites[static_cast<size_t>(spriteIndex)];}
+sg_image sgl::TextureAtlas::getPageImage(const int &page) {return this->pages[static_cast<size_t>(page)].get();}
+int sgl::TextureAtlas::getPageCount(void) {return static_cast<int>(this->pages.size());}
@@ -0,0 +1,77 @@
+#include"../Engine.hpp"
+
+// Constructor - Image Desc Used For Every Texture and Resident Memory Budget in Bytes
+sgl::TextureCache::TextureCache(const sg_image_desc &imgDesc, const size_t &budgetBytes) {
+    this->imgDesc = imgDesc;
+    this->budgetBytes = budgetBytes;
+}
+
+// Acquire Texture - Loads It on a Miss (Reloading Evicted Textures), Stays Resident Until Released
+sg_image sgl::TextureCache::acquire(const std::string &texImgFilePath) {
+    // Hit - Mark as Most Recently Used
+    std::unordered_map<std::string, Entry>::iterator entry {this->entries.find(texImgFilePath)};
+    if(entry != this->entries.end()) {
+        this->stats.hits++;
+        entry->second.refCount++;
+        this->lruOrder.splice(this->lruOrder.begin(), this->lruOrder, entry->second.lruPosition);
+        return entry->second.texture.getImage();
+    }
+
+    // Miss - Load Texture and Estimate Its Size From The Filled In Image Desc
+    this->stats.misses++;
+    sg_image_desc texImgDesc {this->imgDesc};
+    sgl::Texture texture(texImgDesc, texImgFilePath);
+    const sg_image image {texture.getImage()};
+
+    // Failed Load - Not Cached So The Next Acquire Retries It, The Failed Image Is Destroyed With The Texture
+    if(sg_query_image_state(image) != SG_RESOURCESTATE_VALID) {
+        this->stats.failures++;
+        return sg_image {SG_INVALID_ID};
+    }
+    const size_t byteSize {getImageByteSize(texImgDesc)};
+    this->lruOrder.push_front(texImgFilePath);
+    this->entries.try_emplace(texImgFilePath, Entry {std::move(texture), byteSize, 1, this->lruOrder.begin()});
+    this->stats.residentBytes += byteSize;
+    this->stats.residentCount++;
+
+    // Make Room For The New Texture
+    this->trim();
+    return image;
+}
+
+// Release Texture - Unreferenced Textures Stay Resident Until Evicted
+void sgl::TextureCache::release(const std::string &texImgFilePath) {
+    std::unordered_map<std::string, Entry>::iterator entry {this->entries.find(texImgFilePath)};
+    if(entry == this->entries.end() || entry->second.refCount == 0) {
+        std::cerr << "Texture Cache Released Texture That Was Not Acquired: " << texImgFilePath << std::endl;
+        return;
+    }
+    if(--entry->second.refCount == 0) this->trim();
+}
+
+// Evict Least Recently Used Unreferenced Textures Until Resident Memory Fits The Budget
+void sgl::TextureCache::trim(void) {
+    std::list<std::string>::iterator position {this->lruOrder.end()};
+    while(this->stats.residentBytes > this->budgetBytes && position != this->lruOrder.begin()) {
+        // Walk From Least Recently Used, Skipping Textures Still Referenced
+        --position;
+        std::unordered_map<std::string, Entry>::iterator entry {this->entries.find(*position)};
+        if(entry->second.refCount > 0) continue;
+
+        // Evict Texture - Destroyed Along With Its Entry
+        this->stats.residentBytes -= entry->second.byteSize;
+        this->stats.residentCount--;
+        this->stats.evictions++;
+        position = this->lruOrder.erase(position);
+        this->entries.erase(entry);
+    }
+}
+
+// Setters
+void sgl::TextureCache::setBudget(const size_t &budgetBytes) {
+    this->budgetBytes = budgetBytes;
+    this->trim();
+}
+
+// Getters
+const sgl::TextureCache::Stats &sgl::TextureCache::getStats(void) {return this->stats;}
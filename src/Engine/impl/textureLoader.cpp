@@ -0,0 +1,165 @@
+#include"../Engine.hpp"
+
+// Placeholder Texture Image - 2x2 Magenta/Black Checkerboard Shown Until The Real Image Is Uploaded
+static const uint8_t placeholderTexImg[2 * 2 * 4] {
+    255, 0, 255, 255,   0, 0, 0, 255,
+    0, 0, 0, 255,       255, 0, 255, 255,
+};
+
+// Constructor - Start Worker Threads
+sgl::TextureLoader::TextureLoader(const unsigned int &numThreads, const size_t &uploadBudget) {
+    // Maximum Number of Bytes Uploaded Per Frame
+    this->uploadBudget = uploadBudget;
+
+    // Start Worker Threads - At Least One
+    for(unsigned int i {0}; i < std::max(numThreads, 1u); i++) {
+        this->workers.emplace_back(&sgl::TextureLoader::workerMain, this);
+    }
+}
+
+// Destructor - Stop Worker Threads and Free Any Decoded Image Data Not Yet Uploaded
+sgl::TextureLoader::~TextureLoader(void) {
+    // Wake Up and Join Worker Threads
+    {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        this->stopping = true;
+    }
+    this->decodeCondition.notify_all();
+    for(std::thread &worker : this->workers) {
+        worker.join();
+    }
+
+    // Free Decoded Image Data
+    for(Job &job : this->uploadQueue) {
+        stbi_image_free(job.texImg);
+    }
+}
+
+// Queue Texture Image File For Decoding - Returns an Image Holding a Placeholder Until Uploaded
+sg_image sgl::TextureLoader::load(const sg_image_desc &imgDesc, const std::string &texImgFilePath) {
+    // Allocate Image Handle and Initialize It With The Placeholder
+    sg_image image {sg_alloc_image()};
+    sg_image_desc placeholderDesc {imgDesc};
+    placeholderDesc.width = 2;
+    placeholderDesc.height = 2;
+    placeholderDesc.num_mipmaps = 1;
+    placeholderDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
+    placeholderDesc.data.subimage[0][0] = SG_RANGE(placeholderTexImg);
+    sg_init_image(image, &placeholderDesc);
+
+    // Queue Texture Image File For Decoding
+    {
+        std::lock_guard<std::mutex> lock(this->queueMutex);
+        Job job;
+        job.image = image;
+        job.imgDesc = imgDesc;
+        job.texImgFilePath = texImgFilePath;
+        job.decompressBlockFormats = !canSampleBlockFormats();
+        this->decodeQueue.push_back(std::move(job));
+        this->pendingCount++;
+    }
+    this->decodeCondition.notify_one();
+    return image;
+}
+
+// Upload Decoded Texture Images - Call Once Per Frame, Uploads At Most uploadBudget Bytes (At Least One Image)
+void sgl::TextureLoader::update(void) {
+    size_t uploadedBytes {0};
+    while(true) {
+        // Take The Next Decoded Texture Image If It Fits in This Frame's Upload Budget
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(this->queueMutex);
+            if(this->uploadQueue.empty()) break;
+            const Job &nextJob {this->uploadQueue.front()};
+            size_t jobBytes {static_cast<size_t>(nextJob.texWidth) * nextJob.texHeight * 4};
+            if(nextJob.texBlob) jobBytes = nextJob.texBlobFallback.empty() ? nextJob.texBlob->getSize() : nextJob.texBlobFallback.size();
+            if(uploadedBytes > 0 && uploadedBytes + jobBytes > this->uploadBudget) break;
+            job = std::move(this->uploadQueue.front());
+            this->uploadQueue.pop_front();
+            uploadedBytes += jobBytes;
+        }
+
+        if(job.texBlob) {
+            // Replace The Placeholder With The Cooked Texture Blob's Mip Levels - Image Desc Was Filled In by The Worker
+            if(job.texBlobLoaded) {
+                sg_uninit_image(job.image);
+                sg_init_image(job.image, &job.imgDesc);
+            } else {
+                std::cerr << "Failed to Load Texture Blob File: " << job.texImgFilePath << std::endl;
+            }
+        } else if(job.texImg) {
+            // Replace The Placeholder With The Decoded Texture Image - The Image Handle Stays The Same
+            job.imgDesc.width = job.texWidth;
+            job.imgDesc.height = job.texHeight;
+            job.imgDesc.data.subimage[0][0].ptr = job.texImg;
+            job.imgDesc.data.subimage[0][0].size = static_cast<size_t>(job.texWidth) * job.texHeight * 4;
+            sg_uninit_image(job.image);
+            sg_init_image(job.image, &job.imgDesc);
+        } else {
+            // Display Error Message - The Placeholder Is Kept
+            std::cerr << "Failed to Load Texture Image File: " << job.texImgFilePath << std::endl;
+        }
+
+        // Free Texture Image Data From Memory - Blob Mappings Are Released With The Job
+        stbi_image_free(job.texImg);
+
+        // Job Is Done
+        {
+            std::lock_guard<std::mutex> lock(this->queueMutex);
+            this->pendingCount--;
+        }
+    }
+}
+
+// Block Until Every Queued Texture Image Has Been Decoded and Uploaded
+void sgl::TextureLoader::finish(void) {
+    while(this->getPendingCount() > 0) {
+        // Wait For The Next Decoded Texture Image, Then Upload Everything Decoded So Far
+        {
+            std::unique_lock<std::mutex> lock(this->queueMutex);
+            this->uploadCondition.wait(lock, [this] {return !this->uploadQueue.empty();});
+        }
+        this->update();
+    }
+}
+
+// Getters
+size_t sgl::TextureLoader::getPendingCount(void) {
+    std::lock_guard<std::mutex> lock(this->queueMutex);
+    return this->pendingCount;
+}
+
+// Worker Thread Main Loop
+void sgl::TextureLoader::workerMain(void) {
+    // Flip Texture Images Vertically Upon Loading Them - Per Thread, Matches sgl::Texture
+    stbi_set_flip_vertically_on_load_thread(true);
+
+    while(true) {
+        // Wait For a Texture Image File to Decode
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(this->queueMutex);
+            this->decodeCondition.wait(lock, [this] {return this->stopping || !this->decodeQueue.empty();});
+            if(this->stopping) return;
+            job = std::move(this->decodeQueue.front());
+            this->decodeQueue.pop_front();
+        }
+
+        // Map Cooked Texture Blob or Load Texture Image File
+        if(isTextureBlob(job.texImgFilePath)) {
+            job.texBlob = std::make_unique<MappedFile>(job.texImgFilePath);
+            job.texBlobLoaded = loadTextureBlob(*job.texBlob, job.imgDesc, job.texBlobFallback, job.decompressBlockFormats);
+        } else {
+            int texNrChannels;
+            job.texImg = stbi_load(job.texImgFilePath.c_str(), &job.texWidth, &job.texHeight, &texNrChannels, 4);
+        }
+
+        // Hand The Decoded Texture Image Over to The Render Thread
+        {
+            std::lock_guard<std::mutex> lock(this->queueMutex);
+            this->uploadQueue.push_back(std::move(job));
+        }
+        this->uploadCondition.notify_all();
+    }
+}
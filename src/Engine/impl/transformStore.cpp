@@ -0,0 +1,114 @@
+#include"../Engine.hpp"
+
+// Transforms Per Job When Building Local Matrices in Parallel
+static const size_t localMatrixGrainSize {4096};
+
+// Multiply Two Matrices - SSE When Available
+static void multiplyMatrix(const glm::mat4 &lhs, const glm::mat4 &rhs, glm::mat4 &out) {
+    sgl::TransformStore::multiply(lhs, &rhs, &out, 1);
+}
+
+// Add Transform - The Parent Must Already Be Added (-1 For None), Returns The Transform's Index
+uint32_t sgl::TransformStore::add(const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale, const int &parent) {
+    const uint32_t index {static_cast<uint32_t>(this->positions.size())};
+    if(parent >= static_cast<int>(index)) {
+        // Display Error Message and Add as a Root
+        std::cerr << "Failed to Set Transform Parent " << parent << " - Parents Must Be Added Before Their Children" << std::endl;
+    }
+    const int validParent {parent < static_cast<int>(index) ? parent : -1};
+
+    // Add Components
+    this->positions.push_back(position);
+    this->rotations.push_back(rotation);
+    this->scales.push_back(scale);
+    this->parents.push_back(validParent);
+    this->dirtyFlags.push_back(localDirty | worldDirty);
+    this->localMatrices.emplace_back(1.0f);
+    this->worldMatrices.emplace_back(1.0f);
+    if(validParent >= 0) this->childIndices.push_back(index);
+    return index;
+}
+
+// Setters - Mark The Transform (And Through update, Its Descendants) Dirty, Safe From Jobs Setting Different Transforms
+void sgl::TransformStore::setPosition(const uint32_t &index, const glm::vec3 &position) {
+    this->positions[index] = position;
+    this->dirtyFlags[index] = localDirty | worldDirty;
+}
+void sgl::TransformStore::setRotation(const uint32_t &index, const glm::quat &rotation) {
+    this->rotations[index] = rotation;
+    this->dirtyFlags[index] = localDirty | worldDirty;
+}
+void sgl::TransformStore::setScale(const uint32_t &index, const glm::vec3 &scale) {
+    this->scales[index] = scale;
+    this->dirtyFlags[index] = localDirty | worldDirty;
+}
+
+// Update World Matrices of Dirty Transforms - Local Matrices Are Built in Parallel When a Job System Is Given
+void sgl::TransformStore::update(JobSystem* jobSystem) {
+    // Children of Dirty Parents Need Their World Matrix Recomposed - Parents Come First So One Pass Reaches Every Descendant
+    for(const uint32_t &index : this->childIndices) {
+        if(this->dirtyFlags[this->parents[index]] & worldDirty) this->dirtyFlags[index] |= worldDirty;
+    }
+
+    // Build Local Matrices From Position, Rotation and Scale - Roots Write Theirs Straight Into The World Matrix
+    const auto updateRange = [this](const size_t &begin, const size_t &end) {
+        for(size_t i {begin}; i < end; i++) {
+            if(this->dirtyFlags[i] == 0) continue;
+            const bool root {this->parents[i] < 0};
+            if(this->dirtyFlags[i] & localDirty) {
+                glm::mat4 &localMatrix {root ? this->worldMatrices[i] : this->localMatrices[i]};
+                localMatrix = makeLocalMatrix(this->positions[i], this->rotations[i], this->scales[i]);
+            }
+            if(root) this->dirtyFlags[i] = 0;
+        }
+    };
+    if(jobSystem) {
+        jobSystem->parallelFor(this->positions.size(), localMatrixGrainSize, updateRange);
+    } else {
+        updateRange(0, this->positions.size());
+    }
+
+    // Compose Children's World Matrices in Index Order So Each Parent Is Done Before Its Children
+    for(const uint32_t &index : this->childIndices) {
+        if(this->dirtyFlags[index] & worldDirty) {
+            multiplyMatrix(this->worldMatrices[this->parents[index]], this->localMatrices[index], this->worldMatrices[index]);
+        }
+        this->dirtyFlags[index] = 0;
+    }
+}
+
+// Multiply One Matrix by a Batch (out[i] = lhs * rhs[i]) With SSE When Available - Apply a Shared View-Projection Once Per Frame
+void sgl::TransformStore::multiply(const glm::mat4 &lhs, const glm::mat4* rhs, glm::mat4* out, const size_t &count) {
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+    // Load The Shared Matrix Once, Then Stream The Batch Through glm_mat4_mul
+    glm_vec4 lhsColumns[4], rhsColumns[4], outColumns[4];
+    for(int column {0}; column < 4; column++) lhsColumns[column] = _mm_loadu_ps(&lhs[column][0]);
+    for(size_t i {0}; i < count; i++) {
+        for(int column {0}; column < 4; column++) rhsColumns[column] = _mm_loadu_ps(&rhs[i][column][0]);
+        glm_mat4_mul(lhsColumns, rhsColumns, outColumns);
+        for(int column {0}; column < 4; column++) _mm_storeu_ps(&out[i][column][0], outColumns[column]);
+    }
+#else
+    for(size_t i {0}; i < count; i++) out[i] = lhs * rhs[i];
+#endif
+}
+
+// Build a Local Matrix From Position, Rotation and Scale (Translate * Rotate * Scale)
+glm::mat4 sgl::TransformStore::makeLocalMatrix(const glm::vec3 &position, const glm::quat &rotation, const glm::vec3 &scale) {
+    const glm::mat3 rotationMatrix {glm::mat3_cast(rotation)};
+    glm::mat4 localMatrix;
+    localMatrix[0] = glm::vec4(rotationMatrix[0] * scale.x, 0.0f);
+    localMatrix[1] = glm::vec4(rotationMatrix[1] * scale.y, 0.0f);
+    localMatrix[2] = glm::vec4(rotationMatrix[2] * scale.z, 0.0f);
+    localMatrix[3] = glm::vec4(position, 1.0f);
+    return localMatrix;
+}
+
+// Getters
+const glm::mat4 &sgl::TransformStore::getWorldMatrix(const uint32_t &index) {return this->worldMatrices[index];}
+const glm::mat4* sgl::TransformStore::getWorldMatrices(void) {return this->worldMatrices.data();}
+glm::vec3 sgl::TransformStore::getPosition(const uint32_t &index) {return this->positions[index];}
+glm::quat sgl::TransformStore::getRotation(const uint32_t &index) {return this->rotations[index];}
+glm::vec3 sgl::TransformStore::getScale(const uint32_t &index) {return this->scales[index];}
+int sgl::TransformStore::getParent(const uint32_t &index) {return this->parents[index];}
+size_t sgl::TransformStore::getCount(void) {return this->positions.size();}
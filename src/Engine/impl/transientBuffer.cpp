@@ -0,0 +1,71 @@
+#include"../Engine.hpp"
+
+// Sokol Appends at Offsets Rounded Up to Multiples of 4 Bytes
+static size_t roundUp4(const size_t &size) {return (size + 3) & ~static_cast<size_t>(3);}
+
+// Constructor - Buffer Type (Vertex or Index) and Initial Capacity in Bytes
+sgl::TransientBuffer::TransientBuffer(const sg_buffer_type &type, const size_t &initialCapacity) {
+    this->type = type;
+    this->addBlock(roundUp4(std::max(initialCapacity, static_cast<size_t>(4))));
+}
+
+// Start a New Frame - Call Once Per Frame Before Allocating, Merges Last Frame's Spill Buffers Into One Big Enough Buffer
+void sgl::TransientBuffer::beginFrame(void) {
+    // Last Frame Spilled Into Extra Blocks - Replace Them All With One Block Fitting Its Usage
+    if(this->blocks.size() > 1) {
+        size_t capacity {this->blocks[0].capacity};
+        while(capacity < this->frameUsage) capacity *= 2;
+        this->blocks.clear();
+        this->addBlock(capacity);
+    }
+
+    // Rewind - Sokol Rewinds Its Own Append Position on The First Append of a Frame
+    for(Block &block : this->blocks) {
+        block.usage = 0;
+    }
+    this->frameUsage = 0;
+}
+
+// Append Data For This Frame - Valid Until The Frame Is Committed
+sgl::TransientAlloc sgl::TransientBuffer::alloc(const sg_range &data) {
+    // Spill Into a New Block, At Least Twice as Big, When The Current One Cannot Fit The Data
+    const size_t size {roundUp4(data.size)};
+    if(this->blocks.back().usage + size > this->blocks.back().capacity) {
+        this->addBlock(std::max(this->blocks.back().capacity * 2, size));
+    }
+
+    // Append Data
+    Block &block {this->blocks.back()};
+    TransientAlloc transientAlloc;
+    transientAlloc.buffer = block.buffer.get();
+    transientAlloc.offset = sg_append_buffer(block.buffer.get(), data);
+    if(sg_query_buffer_overflow(block.buffer.get())) {
+        // Display Error Message - Only Happens if beginFrame Was Not Called For This Frame
+        std::cerr << "Transient Buffer Overflowed - Call beginFrame Once Per Frame" << std::endl;
+        transientAlloc.offset = -1;
+    }
+
+    // Track Usage
+    block.usage += size;
+    this->frameUsage += size;
+    this->peakUsage = std::max(this->peakUsage, this->frameUsage);
+    return transientAlloc;
+}
+
+// Getters
+size_t sgl::TransientBuffer::getFrameUsage(void) {return this->frameUsage;}
+size_t sgl::TransientBuffer::getPeakUsage(void) {return this->peakUsage;}
+size_t sgl::TransientBuffer::getCapacity(void) {
+    size_t capacity {0};
+    for(const Block &block : this->blocks) capacity += block.capacity;
+    return capacity;
+}
+
+// Create a Stream Buffer Block
+void sgl::TransientBuffer::addBlock(const size_t &capacity) {
+    sg_buffer_desc bufferDesc {};
+    bufferDesc.type = this->type;
+    bufferDesc.usage = SG_USAGE_STREAM;
+    bufferDesc.size = capacity;
+    this->blocks.push_back({BufferHandle(sg_make_buffer(&bufferDesc)), capacity});
+}
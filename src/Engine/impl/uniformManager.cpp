@@ -0,0 +1,67 @@
+#include"../Engine.hpp"
+
+// Forget Applied Blocks - Call After sg_apply_pipeline or Beginning a Pass
+void sgl::UniformManager::reset(void) {
+    for(auto &stageBlocks : this->appliedBlocks) {
+        for(AppliedBlock &appliedBlock : stageBlocks) {
+            appliedBlock.hash = 0;
+            appliedBlock.data.clear();
+        }
+    }
+}
+
+// Apply Uniform Block - Returns False If It Was Skipped Because The Same Data Is Already Applied
+bool sgl::UniformManager::apply(const sg_shader_stage &stage, const int &slot, const sg_range &data) {
+    return this->apply(stage, slot, data, hashBytes(data.ptr, data.size));
+}
+bool sgl::UniformManager::apply(const sg_shader_stage &stage, const int &slot, const sg_range &data, const uint64_t &hash) {
+    // Skip Blocks Identical to The Last One Applied Here - The Hash Rejects Most Changed Blocks, The Bytes Rule Out Collisions
+    const AppliedBlock &appliedBlock {this->appliedBlocks[stage][slot]};
+    if(data.size > 0 && appliedBlock.data.size() == data.size && appliedBlock.hash == hash && std::memcmp(appliedBlock.data.data(), data.ptr, data.size) == 0) {
+        this->stats.skips++;
+        this->stats.bytesSkipped += data.size;
+        return false;
+    }
+
+    // Apply Block
+    sg_apply_uniforms(stage, slot, data);
+    this->record(stage, slot, data, hash, true);
+    return true;
+}
+
+// Apply Uniform Block Without Checking It - For Data That Changes Every Draw (Per-Object Blocks), Where Hashing Would Never Pay Off
+void sgl::UniformManager::applyChanged(const sg_shader_stage &stage, const int &slot, const sg_range &data) {
+    // Recorded Without Data (Unknown), So The Next Checked Apply to This Slot Always Goes Through
+    sg_apply_uniforms(stage, slot, data);
+    this->record(stage, slot, data, 0, false);
+}
+
+// Record an Applied Block (Its Data Copied Only When hashed) and Count The Bytes Uploaded
+void sgl::UniformManager::record(const sg_shader_stage &stage, const int &slot, const sg_range &data, const uint64_t &hash, const bool &hashed) {
+    AppliedBlock &appliedBlock {this->appliedBlocks[stage][slot]};
+    const uint8_t* bytes {static_cast<const uint8_t*>(data.ptr)};
+    appliedBlock.hash = hash;
+    if(hashed) {
+        appliedBlock.data.assign(bytes, bytes + data.size);
+    } else {
+        appliedBlock.data.clear();
+    }
+    this->stats.applies++;
+    this->stats.bytesUploaded += data.size;
+    this->frameBytes += data.size;
+    this->peakFrameBytes = std::max(this->peakFrameBytes, this->frameBytes);
+}
+
+// Start a New Frame - Bytes Uploaded Per Frame Are Counted From Here
+void sgl::UniformManager::beginFrame(void) {this->frameBytes = 0;}
+
+// Reset Statistics
+void sgl::UniformManager::resetStats(void) {
+    this->stats = {};
+    this->peakFrameBytes = 0;
+}
+
+// Getters
+const sgl::UniformManager::Stats &sgl::UniformManager::getStats(void) {return this->stats;}
+size_t sgl::UniformManager::getFrameBytes(void) {return this->frameBytes;}
+size_t sgl::UniformManager::getPeakFrameBytes(void) {return this->peakFrameBytes;}
@@ -0,0 +1,45 @@
+// Mesh Cooker - Parses a Wavefront OBJ File Once, Optimises It and Writes a Mesh Blob The Engine Maps Straight Into GPU Buffers
+// Usage: meshCooker [--quantize] <Input OBJ File> <Output Mesh Blob File>
+// --quantize Stores 16-Bit Positions and TexCoords and 8-Bit Normals Instead of Floats
+#include"../Engine/Engine.hpp"
+
+// Main
+int main(int argc, char* argv[]) {
+    // Check Arguments
+    const bool quantize {argc == 4 && std::string(argv[1]) == "--quantize"};
+    if(argc != 3 && !quantize) {
+        std::cerr << "Usage: " << argv[0] << " [--quantize] <Input OBJ File> <Output Mesh Blob File>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string objFilePath {argv[argc - 2]}, meshBlobFilePath {argv[argc - 1]};
+
+    // Load OBJ File
+    sgl::MeshData mesh;
+    if(!sgl::loadOBJ(objFilePath, mesh)) {
+        std::cerr << "Failed to Load OBJ File: " << objFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Optimise - Triangle Order For The Vertex Cache Then Overdraw, Then Vertex Order For Fetching
+    const float sourceACMR {sgl::getACMR(mesh)};
+    const size_t sourceBytesPerVertex {sizeof(glm::vec3) + (mesh.normals.empty() ? 0 : sizeof(glm::vec3)) + (mesh.texCoords.empty() ? 0 : sizeof(glm::vec2))};
+    sgl::optimizeVertexCache(mesh);
+    sgl::optimizeOverdraw(mesh);
+    sgl::optimizeVertexFetch(mesh);
+
+    // Write Mesh Blob File
+    if(!sgl::writeMeshBlob(mesh, meshBlobFilePath, quantize)) return EXIT_FAILURE;
+
+    // Report ACMR and Vertex Size Before and After
+    sgl::MappedFile meshBlob(meshBlobFilePath);
+    sgl::MeshBlobHeader header;
+    if(!sgl::readMeshBlobHeader(meshBlob, header)) {
+        std::cerr << "Failed to Load Mesh Blob File: " << meshBlobFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << meshBlobFilePath << ": ACMR " << sourceACMR << " -> " << sgl::getACMR(mesh)
+              << ", Bytes Per Vertex " << sourceBytesPerVertex << " -> " << header.vertexStride << std::endl;
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,142 @@
+// Texture Cooker - Decodes a Texture Image File Once, Builds Its Full Mip Chain and Writes a Texture Blob
+// Usage: textureCooker [--compress] <Input Texture Image File> <Output Texture Blob File>
+// --compress Encodes Every Mip Level to BC1 (Opaque) or BC3 (Has Alpha) on All CPU Cores
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_RESIZE_IMPLEMENTATION
+#define STB_DXT_IMPLEMENTATION
+#include"../Engine/Engine.hpp"
+
+// STB DXT
+#include<stb_dxt.h>
+
+// STB Image Resize - Its Implementation Is Not Warning Clean Under The Debug Flags
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#include<stb_image_resize2.h>
+#pragma GCC diagnostic pop
+
+// Standard Headers
+#include<fstream>
+#include<atomic>
+
+// Mip Level Pixel Data Is Aligned to This Many Bytes Within The Blob
+static const uint64_t mipAlignment {16};
+
+// Encode an RGBA8 Image to BC1/BC3 - Rows of 4x4 Blocks Are Shared Out Between Worker Threads
+static std::vector<uint8_t> compressImage(const std::vector<uint8_t> &rgba, const int &width, const int &height, const sg_pixel_format &pixelFormat) {
+    const bool alpha {pixelFormat == SG_PIXELFORMAT_BC3_RGBA};
+    const int blocksWide {(width + 3) / 4}, blocksHigh {(height + 3) / 4};
+    const size_t blockSize {alpha ? 16u : 8u};
+    std::vector<uint8_t> blocks(sgl::getBlockCompressedSize(pixelFormat, width, height));
+
+    // Worker Threads Take The Next Unencoded Block Row Until None Are Left
+    std::atomic<int> nextBlockRow {0};
+    auto encodeRows {[&](void) {
+        for(int blockY {nextBlockRow++}; blockY < blocksHigh; blockY = nextBlockRow++) {
+            for(int blockX {0}; blockX < blocksWide; blockX++) {
+                // Gather 4x4 Texels - Edge Blocks Repeat The Last Row/Column
+                uint8_t texels[16 * 4];
+                for(int y {0}; y < 4; y++) {
+                    for(int x {0}; x < 4; x++) {
+                        const int texelX {std::min(blockX * 4 + x, width - 1)}, texelY {std::min(blockY * 4 + y, height - 1)};
+                        std::memcpy(texels + (y * 4 + x) * 4, rgba.data() + (static_cast<size_t>(texelY) * width + texelX) * 4, 4);
+                    }
+                }
+                stb_compress_dxt_block(blocks.data() + (static_cast<size_t>(blockY) * blocksWide + blockX) * blockSize, texels, alpha, STB_DXT_HIGHQUAL);
+            }
+        }
+    }};
+    std::vector<std::thread> workers;
+    for(unsigned int i {1}; i < std::max(std::thread::hardware_concurrency(), 1u); i++) {
+        workers.emplace_back(encodeRows);
+    }
+    encodeRows();
+    for(std::thread &worker : workers) {
+        worker.join();
+    }
+    return blocks;
+}
+
+// Main
+int main(int argc, char* argv[]) {
+    // Check Arguments
+    const bool compress {argc == 4 && std::string(argv[1]) == "--compress"};
+    if(argc != 3 && !compress) {
+        std::cerr << "Usage: " << argv[0] << " [--compress] <Input Texture Image File> <Output Texture Blob File>" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string texImgFilePath {argv[argc - 2]}, texBlobFilePath {argv[argc - 1]};
+
+    // Load Texture Image File - Flipped Vertically Like sgl::Texture Does at Runtime
+    stbi_set_flip_vertically_on_load(true);
+    int texWidth, texHeight, texNrChannels;
+    stbi_uc* texImg {stbi_load(texImgFilePath.c_str(), &texWidth, &texHeight, &texNrChannels, 4)};
+    if(!texImg) {
+        std::cerr << "Failed to Load Texture Image File: " << texImgFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Build Mip Chain - Every Level Is Resampled From The Full Size Image to Avoid Accumulating Filter Error
+    std::vector<std::vector<uint8_t>> mipLevels;
+    mipLevels.emplace_back(texImg, texImg + static_cast<size_t>(texWidth) * texHeight * 4);
+    int mipWidth {texWidth}, mipHeight {texHeight};
+    while((mipWidth > 1 || mipHeight > 1) && mipLevels.size() < SG_MAX_MIPMAPS) {
+        mipWidth = std::max(mipWidth / 2, 1);
+        mipHeight = std::max(mipHeight / 2, 1);
+        std::vector<uint8_t> &mipLevel {mipLevels.emplace_back(static_cast<size_t>(mipWidth) * mipHeight * 4)};
+        stbir_resize_uint8_srgb(texImg, texWidth, texHeight, 0, mipLevel.data(), mipWidth, mipHeight, 0, STBIR_RGBA);
+    }
+    stbi_image_free(texImg);
+
+    // Block Compress Every Mip Level - BC3 Only When Some Texel Is Not Fully Opaque
+    sg_pixel_format pixelFormat {SG_PIXELFORMAT_RGBA8};
+    if(compress) {
+        pixelFormat = SG_PIXELFORMAT_BC1_RGBA;
+        for(size_t i {3}; i < mipLevels[0].size(); i += 4) {
+            if(mipLevels[0][i] != 255) {
+                pixelFormat = SG_PIXELFORMAT_BC3_RGBA;
+                break;
+            }
+        }
+        for(size_t mip {0}; mip < mipLevels.size(); mip++) {
+            const int mipWidth {std::max(texWidth >> mip, 1)}, mipHeight {std::max(texHeight >> mip, 1)};
+            mipLevels[mip] = compressImage(mipLevels[mip], mipWidth, mipHeight, pixelFormat);
+        }
+    }
+
+    // Fill Header - Mip Levels Follow The Header, Largest First
+    sgl::TextureBlobHeader header {};
+    std::memcpy(header.magic, sgl::textureBlobMagic, sizeof(header.magic));
+    header.version = sgl::textureBlobVersion;
+    header.width = static_cast<uint32_t>(texWidth);
+    header.height = static_cast<uint32_t>(texHeight);
+    header.pixelFormat = pixelFormat;
+    header.numMipmaps = static_cast<uint32_t>(mipLevels.size());
+    uint64_t offset {sizeof(header)};
+    for(size_t mip {0}; mip < mipLevels.size(); mip++) {
+        offset = (offset + mipAlignment - 1) / mipAlignment * mipAlignment;
+        header.mipOffsets[mip] = offset;
+        header.mipSizes[mip] = mipLevels[mip].size();
+        offset += mipLevels[mip].size();
+    }
+
+    // Write Texture Blob File
+    std::ofstream texBlobFile(texBlobFilePath, std::ios::binary);
+    if(!texBlobFile) {
+        std::cerr << "Failed to Open Texture Blob File: " << texBlobFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+    texBlobFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for(size_t mip {0}; mip < mipLevels.size(); mip++) {
+        texBlobFile.seekp(static_cast<std::streamoff>(header.mipOffsets[mip]));
+        texBlobFile.write(reinterpret_cast<const char*>(mipLevels[mip].data()), static_cast<std::streamsize>(mipLevels[mip].size()));
+    }
+    if(!texBlobFile) {
+        std::cerr << "Failed to Write Texture Blob File: " << texBlobFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // Return Successful Exit Code
+    return EXIT_SUCCESS;
+}
@@ -1,3 +1,2 @@
-// Test Shader
-#include"shaders/build/testShader.h"
-testVSUniforms_t testShaderVSUniforms;
+// Surface Shader - Every Permutation, All Sharing One Uniform Block Layout
+#include"shaders/build/surfaceShaderPermutations.h"
@@ -2,6 +2,7 @@
 #define SOKOL_IMPL
 #define SOKOL_GLCORE33
 #define STB_IMAGE_IMPLEMENTATION
+#define STB_RECT_PACK_IMPLEMENTATION
 #include"Engine/Engine.hpp"
 
 // Include Shaders
@@ -24,6 +25,33 @@ int windowWidth {800}, windowHeight {600};
 const bool windowFullscreen {true};
 const float windowBgColor[4] {0.2f, 0.3f, 0.3f, 1.0f};
 
+// Job System Config - Threads Running Jobs, Including The Main Thread
+const unsigned int jobThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+
+// Texture Loader Config - Decode Threads and Bytes Uploaded Per Frame
+const unsigned int texLoaderThreads {std::max(std::thread::hardware_concurrency(), 1u)};
+const size_t texLoaderUploadBudget {8 * 1024 * 1024};
+
+// Instanced Grid Config - Grid Size x Grid Size Triangles Drawn With One Draw Call
+const int instanceGridSize {100};
+const float instanceGridSpacing {1.0f};
+
+// Shape Cache Config - Vertices and Indices Shared by Every Procedural Shape
+const int shapeCacheVertices {16384}, shapeCacheIndices {65536};
+
+// Shape Fog Config - Density For The Surface Shader's FOG Permutation, Fogged Towards The Window Background Color
+const float shapeFogDensity {0.15f};
+
+// Profiler Config - Frames Kept and Chrome Trace Written on Exit
+const int profilerFrames {300};
+const std::string profilerTracePath {"frameTrace.json"};
+
+// Shader Hot Reload Config - Watched Shader Sources and The sokol-shdc Binary Recompiling Them, Both Set by CMake
+#ifdef SGL_SHADER_HOT_RELOAD
+const std::string shaderSrcDirPath {SGL_SHADER_SRC_DIR};
+const std::string shaderCompilerPath {SGL_SHADER_COMPILER};
+#endif
+
 // Delta Time
 float lastTime, currentTime, deltaTime;
 
@@ -73,6 +101,10 @@ int main(void) {
     // Set GLFW Input Mode
     glfwSetInputMode(win, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
+    // Camera Projection - Matches The Window
+    camera.setAspectRatio(static_cast<float>(windowWidth) / static_cast<float>(windowHeight));
+    camera.setClipPlanes(0.1f, 100.0f);
+
     // Set GLFW Callbacks
     glfwSetFramebufferSizeCallback(win, FramebufferSizeCallback);
     glfwSetCursorPosCallback(win, MouseCallback);
@@ -83,97 +115,290 @@ int main(void) {
     sokolSetupDesc.logger.func = slog_func;
     sg_setup(&sokolSetupDesc);
 
-    // Triangle Data
-    const float triangleVertices[] {
-        -0.4f, -0.5f, 0.0f, 0.0f, 0.0f,
-        0.4f, -0.5f, 0.0f, 1.0f, 0.0f,
-        0.0f, 0.5f, 0.0f, 0.5f, 1.0f,
+    // Triangle Mesh - Cooked by scripts/cookMeshes.sh, Mapped Straight Into Its Vertex and Index Buffers
+    // Its Position Transform Maps Quantized Positions Back Into Model Space and Is Folded Into Every Model Matrix
+    sgl::Mesh triangleMesh("../assets/meshes/cooked/triangle.obj.sglmesh");
+    const glm::mat4 trianglePositionTransform {triangleMesh.getPositionTransform()};
+
+    // Procedural Shapes - Plane, Box, Sphere, Cylinder and Torus Sharing One Vertex and Index Buffer
+    sgl::ShapeCache shapeCache(shapeCacheVertices, shapeCacheIndices);
+    const sshape_element_range_t shapeRanges[] {
+        shapeCache.getPlane(0.8f, 0.8f, 4),
+        shapeCache.getBox(0.6f, 0.6f, 0.6f),
+        shapeCache.getSphere(0.4f, 24, 16),
+        shapeCache.getCylinder(0.3f, 0.8f, 24),
+        shapeCache.getTorus(0.35f, 0.12f, 16, 24),
     };
-    const uint16_t triangleIndices[] {
-        0, 1, 2,
+    shapeCache.upload();
+
+    // Procedural Shape Bounds in Model Space - Same Order as shapeRanges
+    const sgl::AABB shapeBounds[] {
+        {glm::vec3(-0.4f, 0.0f, -0.4f), glm::vec3(0.4f, 0.0f, 0.4f)},
+        {glm::vec3(-0.3f), glm::vec3(0.3f)},
+        {glm::vec3(-0.4f), glm::vec3(0.4f)},
+        {glm::vec3(-0.3f, -0.4f, -0.3f), glm::vec3(0.3f, 0.4f, 0.3f)},
+        {glm::vec3(-0.47f, -0.12f, -0.47f), glm::vec3(0.47f, 0.12f, 0.47f)},
     };
 
-    // Vertex Buffer Objects
-    // Triangle VBO
-    sg_buffer_desc triangleVBODesc {};
-    triangleVBODesc.type = SG_BUFFERTYPE_VERTEXBUFFER;
-    triangleVBODesc.data = SG_RANGE_REF(triangleVertices);
-    sg_buffer triangleVBO {sg_make_buffer(&triangleVBODesc)};
-
-    // Index/Element Buffer Objects
-    // Triangle IBO
-    sg_buffer_desc triangleIBODesc {};
-    triangleIBODesc.type = SG_BUFFERTYPE_INDEXBUFFER;
-    triangleIBODesc.data = SG_RANGE_REF(triangleIndices);
-    sg_buffer triangleIBO {sg_make_buffer(&triangleIBODesc)};
-
-    // Shaders
-    sg_shader testShader {sg_make_shader(testShader_shader_desc(sg_query_backend()))};
+    // Sampler Cache - Identical Descs Share One Object
+    sgl::SamplerCache samplerCache;
 
     // Textures
+    sgl::TextureLoader texLoader(texLoaderThreads, texLoaderUploadBudget);
+
     sg_sampler_desc testTexSmpDesc {};
     testTexSmpDesc.min_filter = SG_FILTER_NEAREST;
     testTexSmpDesc.mag_filter = SG_FILTER_NEAREST;
-    sg_sampler testTexSmp {sg_make_sampler(testTexSmpDesc)};
+    testTexSmpDesc.mipmap_filter = SG_FILTER_LINEAR;
+    sg_sampler testTexSmp {samplerCache.get(testTexSmpDesc)};
 
     sg_image_desc testTexImgDesc {};
     testTexImgDesc.type = SG_IMAGETYPE_2D;
     testTexImgDesc.pixel_format = SG_PIXELFORMAT_RGBA8;
     testTexImgDesc.usage = SG_USAGE_IMMUTABLE;
-    sgl::Texture testTex(testTexImgDesc, "../assets/textures/wall.jpg");
+    sgl::Texture testTex(texLoader, testTexImgDesc, "../assets/textures/cooked/wall.jpg.sgltex");
 
     // Bindings
-    // Test Object Bindings
-    sg_bindings testObjBindings {};
-    testObjBindings.vertex_buffers[0] = triangleVBO;
-    testObjBindings.index_buffer = triangleIBO;
-    testObjBindings.fs.images[SLOT_testTexImg] = testTex.getImage();
-    testObjBindings.fs.samplers[SLOT_testTexSmp] = testTexSmp;
-
-    // Pipeline Objects
-    // Test Object Pipeline
+    // Mesh Bindings - Vertex and Index Buffers Only, Materials Add Their Textures
+    sg_bindings triangleMeshBindings {};
+    triangleMeshBindings.vertex_buffers[0] = triangleMesh.getVertexBuffer();
+    triangleMeshBindings.index_buffer = triangleMesh.getIndexBuffer();
+    sg_bindings shapeMeshBindings {};
+    shapeMeshBindings.vertex_buffers[0] = shapeCache.getVertexBuffer();
+    shapeMeshBindings.index_buffer = shapeCache.getIndexBuffer();
+
+    // Instanced Grid Mesh Bindings - Triangle Vertices Per Vertex, Model Matrices Per Instance
+    sgl::InstanceBuffer instanceBuffer(instanceGridSize * instanceGridSize);
+    sg_bindings instancedGridMeshBindings {triangleMeshBindings};
+    instancedGridMeshBindings.vertex_buffers[1] = instanceBuffer.getBuffer();
+
+    // Render Queue - Draw Packets Are Sorted by Key and Redundant State Changes Skipped
+    sgl::RenderQueue renderQueue;
+
+    // Shader Hot Reload - Saving a Shader Source Rebuilds The Shaders and Pipelines Made From It While Running
+    // The Surface Shader Registry Watches Every Permutation and Pipeline It Creates
+#ifdef SGL_SHADER_HOT_RELOAD
+    sgl::ShaderReloader shaderReloader(shaderSrcDirPath, shaderCompilerPath);
+    sgl::ShaderReloader* surfaceShaderReloader {&shaderReloader};
+#else
+    sgl::ShaderReloader* surfaceShaderReloader {nullptr};
+#endif
+
+    // Surface Shader Pipeline Descs - Vertex Layout and Render State For The Test Object, The Shapes and The Instanced Grid
+    // Attribute Locations and Uniform Block Bindings Are Fixed in surfaceShader.glsl, So Permutation 0's Match Every Permutation
+    sgl::ShaderRegistry surfaceShaders(surfaceShader_name, surfaceShader_permutations, surfaceShader_features, surfaceShader_permutation_count, surfaceShaderReloader);
     sg_pipeline_desc testObjPipelineDesc {};
-    testObjPipelineDesc.shader = testShader;
-    testObjPipelineDesc.layout.attrs[ATTR_vs_vertexPosition].format = SG_VERTEXFORMAT_FLOAT3;
-    testObjPipelineDesc.layout.attrs[ATTR_vs_textureCoords].format = SG_VERTEXFORMAT_FLOAT2;
-    testObjPipelineDesc.index_type = SG_INDEXTYPE_UINT16;
+    triangleMesh.setLayout(testObjPipelineDesc, 0, ATTR_surfaceShader_0_surfaceVS_vertexPosition, -1, ATTR_surfaceShader_0_surfaceVS_textureCoords);
     testObjPipelineDesc.depth.compare = SG_COMPAREFUNC_LESS;
     testObjPipelineDesc.depth.write_enabled = true;
     testObjPipelineDesc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
-    sg_pipeline testObjPipeline {sg_make_pipeline(&testObjPipelineDesc)};
+    sg_pipeline_desc shapePipelineDesc {};
+    sgl::ShapeCache::setLayout(shapePipelineDesc, 0, ATTR_surfaceShader_0_surfaceVS_vertexPosition, -1, ATTR_surfaceShader_0_surfaceVS_textureCoords, -1);
+    shapePipelineDesc.depth.compare = SG_COMPAREFUNC_LESS;
+    shapePipelineDesc.depth.write_enabled = true;
+    shapePipelineDesc.primitive_type = SG_PRIMITIVETYPE_TRIANGLES;
+    sg_pipeline_desc instancedGridPipelineDesc {testObjPipelineDesc};
+    sgl::InstanceBuffer::setLayout(instancedGridPipelineDesc, 1, ATTR_surfaceShader_1_surfaceVS_instanceModel0);
+
+    // Materials - The Test Object Is Plain, The Grid Is Instanced, Shapes Are Fogged and Every Other One Is Also Alpha Tested and Tinted
+    sgl::Material testObjMaterial(surfaceShaders, 0, testObjPipelineDesc);
+    sgl::Material instancedGridMaterial(surfaceShaders, FEATURE_surfaceShader_INSTANCING, instancedGridPipelineDesc);
+    sgl::Material shapeMaterials[2] {
+        sgl::Material(surfaceShaders, FEATURE_surfaceShader_FOG, shapePipelineDesc),
+        sgl::Material(surfaceShaders, FEATURE_surfaceShader_FOG | FEATURE_surfaceShader_ALPHA_TEST, shapePipelineDesc),
+    };
+    const glm::vec4 materialTints[] {glm::vec4(1.0f), glm::vec4(1.0f), glm::vec4(1.0f), glm::vec4(1.0f, 0.8f, 0.6f, 1.0f)};
+    sgl::Material* materials[] {&testObjMaterial, &instancedGridMaterial, &shapeMaterials[0], &shapeMaterials[1]};
+    for(size_t material {0}; material < std::size(materials); material++) {
+        surfaceShader_0_surfaceMaterialUniforms_t materialUniforms {};
+        materialUniforms.tint = materialTints[material];
+        materials[material]->setTexture(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceTexImg, testTex.getImage(), SLOT_surfaceShader_0_surfaceTexSmp, testTexSmp);
+        materials[material]->setUniforms(SG_SHADERSTAGE_FS, SLOT_surfaceShader_0_surfaceMaterialUniforms, SG_RANGE_REF(materialUniforms));
+    }
+
+    // Surface Shader Uniforms - Per Frame (View-Projection and Fog) and Per Object (Model Matrix), Per Material Ones Live in The Materials
+    surfaceShader_0_surfaceFrameUniforms_t surfaceFrameUniforms {};
+    surfaceFrameUniforms.fogColor = glm::vec4(windowBgColor[0], windowBgColor[1], windowBgColor[2], windowBgColor[3]);
+    surfaceFrameUniforms.fogParams = glm::vec4(shapeFogDensity, 0.0f, 0.0f, 0.0f);
+    surfaceShader_0_surfaceObjectUniforms_t surfaceObjectUniforms {};
 
     // Render Pass Action
     sg_pass_action renderPassAction {};
     renderPassAction.colors[0].load_action = SG_LOADACTION_CLEAR;
     renderPassAction.colors[0].clear_value = {windowBgColor[0], windowBgColor[1], windowBgColor[2], windowBgColor[3]};
 
-    // Model and Projection Matrices
-    glm::mat4 modelMatrix, projectionMatrix;
+    // View-Projection Matrix - Multiplied Once Per Frame
+    glm::mat4 viewProjMatrix;
+
+    // Frame Profiler
+    sgl::Profiler profiler(profilerFrames);
+
+    // Job System
+    sgl::JobSystem jobSystem(jobThreads);
+
+    // Transforms - Test Object, Then The Instanced Grid's Triangles Stored Contiguously From firstGridTransform
+    sgl::TransformStore transforms;
+    const glm::quat noRotation {1.0f, 0.0f, 0.0f, 0.0f};
+    const uint32_t testObjTransform {transforms.add(glm::vec3(0.0f), noRotation, glm::vec3(1.0f))};
+    const uint32_t firstGridTransform {static_cast<uint32_t>(transforms.getCount())};
+    for(int x {0}; x < instanceGridSize; x++) {
+        for(int z {0}; z < instanceGridSize; z++) {
+            const glm::vec3 instancePos {(x - instanceGridSize / 2) * instanceGridSpacing, -2.0f, (z - instanceGridSize / 2) * instanceGridSpacing};
+            transforms.add(instancePos, noRotation, glm::vec3(1.0f));
+        }
+    }
+
+    // Scene Graph - The Shapes Are Children of One Carousel Node, So Turning It Moves The Whole Row
+    // The Carousel's Subtree Bounds Cull Every Shape at Once Before Testing Each Shape's Own Bounds
+    sgl::SceneGraph sceneGraph;
+    const sgl::SceneGraph::NodeId shapeCarousel {sceneGraph.addNode(sgl::SceneGraph::invalidNode, glm::vec3(0.0f, 1.5f, 0.0f), noRotation, glm::vec3(1.0f), sgl::AABB())};
+    sgl::SceneGraph::NodeId shapeNodes[std::size(shapeRanges)] {};
+    for(size_t shape {0}; shape < std::size(shapeRanges); shape++) {
+        shapeNodes[shape] = sceneGraph.addNode(shapeCarousel, glm::vec3((static_cast<float>(shape) - 2.0f) * 1.2f, 0.0f, 0.0f), noRotation, glm::vec3(1.0f), shapeBounds[shape]);
+    }
+    bool shapeVisible[std::size(shapeRanges)] {};
+
+    // Instanced Grid Culling and Picking - Triangle Bounds in Model Space and a BVH Over Each Grid Triangle's World Bounds
+    // Proxy i Is Grid Triangle i, The Tree Is Refit as The Triangles Spin
+    const sgl::AABB &triangleBounds {triangleMesh.getBounds()};
+    transforms.update(&jobSystem);
+    std::vector<sgl::AABB> gridBounds(instanceGridSize * instanceGridSize);
+    for(size_t i {0}; i < gridBounds.size(); i++) {
+        gridBounds[i] = triangleBounds.transform(transforms.getWorldMatrix(firstGridTransform + static_cast<uint32_t>(i)));
+    }
+    sgl::BVH gridBVH;
+    gridBVH.build(gridBounds, &jobSystem);
+    std::vector<sgl::BVH::ProxyId> visibleGrid;
+    sgl::BVH::ProxyId pickedGrid {sgl::BVH::invalidProxy};
 
     // Main Loop
     while(!glfwWindowShouldClose(win)) {
+        // Begin Profiling Frame and Counting Uniform Bytes Uploaded
+        profiler.beginFrame();
+        renderQueue.getUniformManager().beginFrame();
+
         // Swap Buffers
+        profiler.beginZone("Swap Buffers");
         glfwSwapBuffers(win);
+        profiler.endZone();
+
+        // Upload Texture Images Decoded Since Last Frame
+        profiler.beginZone("Texture Uploads");
+        texLoader.update();
+        profiler.endZone();
+
+        // Swap In Shaders Recompiled Since Last Frame
+#ifdef SGL_SHADER_HOT_RELOAD
+        profiler.beginZone("Shader Reload");
+        shaderReloader.update();
+        profiler.endZone();
+#endif
 
-        // Projection Matrix
-        projectionMatrix = glm::mat4(1.0f);
-        projectionMatrix = glm::perspective(glm::radians(camera.getFOV()), static_cast<float>(windowWidth) / static_cast<float>(windowHeight), 0.1f, 100.0f);
+        // View-Projection Matrix
+        profiler.beginZone("Camera");
+        viewProjMatrix = camera.getViewProjMat();
+        profiler.endZone();
+
+        // Spin The Test Object, Every Grid Triangle and Every Shape Around Its Own Center, Turn The Shape Carousel, Then Update World Matrices
+        profiler.beginZone("Transforms");
+        const float spinAngle {static_cast<float>(glfwGetTime()) * glm::radians(40.0f)};
+        const glm::vec3 spinAxis {0.0f, 1.0f, 0.0f};
+        transforms.setRotation(testObjTransform, glm::angleAxis(spinAngle, spinAxis));
+        sceneGraph.setRotation(shapeCarousel, glm::angleAxis(spinAngle * 0.25f, spinAxis));
+        for(const sgl::SceneGraph::NodeId &shapeNode : shapeNodes) {
+            sceneGraph.setRotation(shapeNode, glm::angleAxis(spinAngle, glm::normalize(glm::vec3(1.0f, 1.0f, 0.0f))));
+        }
+        sceneGraph.update();
+        jobSystem.parallelFor(instanceGridSize * instanceGridSize, 1024, [&](const size_t &begin, const size_t &end) {
+            for(size_t i {begin}; i < end; i++) {
+                const float gridOffset {static_cast<float>(i / instanceGridSize + i % instanceGridSize)};
+                transforms.setRotation(firstGridTransform + static_cast<uint32_t>(i), glm::angleAxis(spinAngle + gridOffset, spinAxis));
+            }
+        });
+        transforms.update(&jobSystem);
+        profiler.endZone();
+
+        // Refit The Grid's BVH and Cull Grid Triangles and Shapes Outside The View Frustum
+        profiler.beginZone("Culling");
+        const sgl::Frustum viewFrustum(viewProjMatrix);
+        jobSystem.parallelFor(instanceGridSize * instanceGridSize, 1024, [&](const size_t &begin, const size_t &end) {
+            for(size_t i {begin}; i < end; i++) {
+                gridBVH.setBounds(static_cast<sgl::BVH::ProxyId>(i), triangleBounds.transform(transforms.getWorldMatrix(firstGridTransform + static_cast<uint32_t>(i))));
+            }
+        });
+        gridBVH.refit();
+        visibleGrid.clear();
+        gridBVH.query(viewFrustum, visibleGrid);
+        const bool carouselVisible {viewFrustum.intersects(sceneGraph.getSubtreeBounds(shapeCarousel))};
+        for(size_t shape {0}; shape < std::size(shapeRanges); shape++) {
+            shapeVisible[shape] = carouselVisible && viewFrustum.intersects(sceneGraph.getWorldBounds(shapeNodes[shape]));
+        }
+        profiler.endZone();
+
+        // Pick The Grid Triangle The Camera Looks At - Shown in The Window Title
+        profiler.beginZone("Picking");
+        sgl::BVH::RayHit pickHit;
+        const sgl::BVH::ProxyId picked {gridBVH.raycast(camera.getPos(), camera.getFront(), camera.getFarPlane(), pickHit) ? pickHit.proxy : sgl::BVH::invalidProxy};
+        if(picked != pickedGrid) {
+            pickedGrid = picked;
+            const std::string pickedTitle {windowTitle + " - Grid Triangle " + std::to_string(picked)};
+            glfwSetWindowTitle(win, picked == sgl::BVH::invalidProxy ? windowTitle.c_str() : pickedTitle.c_str());
+        }
+        profiler.endZone();
 
         // Begin Render Pass
         sg_begin_default_pass(renderPassAction, windowWidth, windowHeight);
 
-        // Render Test Object
-        sg_apply_pipeline(testObjPipeline);
-        sg_apply_bindings(&testObjBindings);
-        modelMatrix = glm::mat4(1.0f);
-        modelMatrix = glm::rotate(modelMatrix, static_cast<float>(glfwGetTime()) * glm::radians(40.0f), glm::vec3(0.0f, 1.0f, 0.0f));
-        testShaderVSUniforms.pvm = projectionMatrix * camera.getViewMat() * modelMatrix;
-        sg_apply_uniforms(SG_SHADERSTAGE_VS, SLOT_testVSUniforms, SG_RANGE_REF(testShaderVSUniforms));
-        sg_draw(0, 3, 1);
+        // Frame Uniforms - Added Once and Shared by Every Surface Shader Draw
+        profiler.beginZone("Submission");
+        surfaceFrameUniforms.viewProj = viewProjMatrix;
+        const uint32_t surfaceFrameUniformsId {renderQueue.addUniforms(SG_SHADERSTAGE_VS, SLOT_surfaceShader_0_surfaceFrameUniforms, SG_RANGE_REF(surfaceFrameUniforms))};
+
+        // Submit Test Object
+        surfaceObjectUniforms.model = transforms.getWorldMatrix(testObjTransform) * trianglePositionTransform;
+        sgl::DrawPacket testObjPacket;
+        testObjPacket.numElements = triangleMesh.getNumIndices();
+        testObjPacket.frameUniformsId = surfaceFrameUniformsId;
+        testObjPacket.vsUniformSlot = SLOT_surfaceShader_0_surfaceObjectUniforms;
+        testObjMaterial.submit(renderQueue, testObjPacket, triangleMeshBindings, 0.0f, SG_RANGE_REF(surfaceObjectUniforms));
+
+        // Submit Visible Shapes - Same Mesh Buffers For Each, Only The Material and Element Range Change
+        for(uint32_t shape {0}; shape < std::size(shapeRanges); shape++) {
+            if(!shapeVisible[shape]) continue;
+            surfaceObjectUniforms.model = sceneGraph.getWorldMatrix(shapeNodes[shape]);
+            sgl::DrawPacket shapePacket;
+            shapePacket.baseElement = shapeRanges[shape].base_element;
+            shapePacket.numElements = shapeRanges[shape].num_elements;
+            shapePacket.frameUniformsId = surfaceFrameUniformsId;
+            shapePacket.vsUniformSlot = SLOT_surfaceShader_0_surfaceObjectUniforms;
+            shapeMaterials[shape % 2].submit(renderQueue, shapePacket, shapeMeshBindings, 0.0f, SG_RANGE_REF(surfaceObjectUniforms));
+        }
+
+        // Submit Visible Grid Triangles - The Shader Applies The Shared View-Projection to Each Instance's World Matrix
+        profiler.beginZone("Instances");
+        for(const sgl::BVH::ProxyId &gridIndex : visibleGrid) {
+            instanceBuffer.add(transforms.getWorldMatrix(firstGridTransform + gridIndex) * trianglePositionTransform);
+        }
+        instanceBuffer.upload();
+        profiler.endZone();
+        sgl::DrawPacket instancedGridPacket;
+        instancedGridPacket.numElements = triangleMesh.getNumIndices();
+        instancedGridPacket.numInstances = instanceBuffer.getInstanceCount();
+        instancedGridPacket.frameUniformsId = surfaceFrameUniformsId;
+        instancedGridMaterial.submit(renderQueue, instancedGridPacket, instancedGridMeshBindings, 0.0f);
+        profiler.endZone();
+
+        // Draw Submitted Objects
+        profiler.beginZone("Render Queue Flush");
+        renderQueue.flush();
+        profiler.endZone();
+        profiler.setCounter("Uniform Bytes", static_cast<double>(renderQueue.getUniformManager().getFrameBytes()));
 
         // End Render Pass and Submit Frame
+        profiler.beginZone("Commit");
         sg_end_pass();
         sg_commit();
+        profiler.endZone();
 
         // Calculate Delta Time
         currentTime = static_cast<float>(glfwGetTime());
@@ -181,10 +406,18 @@ int main(void) {
         lastTime = currentTime;
 
         // Process User Keyboard Input and Poll Events
+        profiler.beginZone("Input");
         processKeyboardInput(win);
         glfwPollEvents();
+        profiler.endZone();
+
+        // End Profiling Frame
+        profiler.endFrame();
     }
 
+    // Write The Last Frames' Profile
+    profiler.writeChromeTrace(profilerTracePath);
+
     // Terminate Program
     // Shutdown Sokol
     sg_shutdown();
@@ -219,6 +452,7 @@ static void FramebufferSizeCallback(GLFWwindow*, int newWinWidth, int newWinHeig
     sg_apply_viewport(0, 0, newWinWidth, newWinHeight, true);
     windowWidth = newWinWidth;
     windowHeight = newWinHeight;
+    camera.setAspectRatio(static_cast<float>(newWinWidth) / static_cast<float>(newWinHeight));
 }
 static void MouseCallback(GLFWwindow*, double mousePosX, double mousePosY) {
     // Camera Process Mouse Movement - Look Around
@@ -0,0 +1,102 @@
+@ctype mat4 glm::mat4
+@ctype vec4 glm::vec4
+
+// Surface Shader - Compiled Once Per Combination of The Feature Defines Below (See sgl_add_shader_permutations in CMakeLists.txt)
+// Uniform Blocks Are Split by How Often They Change - Per Frame, Per Material and Per Object - So Unchanged Ones Can Be Skipped
+// INSTANCING - Model Matrix Comes From Per-Instance Attributes Instead of The Per-Object Block
+// ALPHA_TEST - Fragments With Texture Alpha Under 0.5 Are Discarded
+// FOG - Exponential Per-Vertex Fog Blended Towards fogColor
+
+@vs surfaceVS
+    // Vertex Attributes - Locations Are Fixed So Every Permutation Shares One Vertex Layout
+    layout(location = 0) in vec3 vertexPosition;
+    layout(location = 1) in vec2 textureCoords;
+
+#ifdef INSTANCING
+    // Instance Attributes - Model Matrix Columns, One Set Per Instance
+    layout(location = 2) in vec4 instanceModel0;
+    layout(location = 3) in vec4 instanceModel1;
+    layout(location = 4) in vec4 instanceModel2;
+    layout(location = 5) in vec4 instanceModel3;
+#endif
+
+    // Per-Frame Uniforms - Same Block in Every Permutation, Fog Members Are Ignored Without FOG
+    layout(binding = 0) uniform surfaceFrameUniforms {
+        mat4 viewProj;
+        vec4 fogColor;
+        vec4 fogParams;
+    };
+
+#ifndef INSTANCING
+    // Per-Object Uniforms
+    layout(binding = 1) uniform surfaceObjectUniforms {
+        mat4 model;
+    };
+#endif
+
+    // Output
+    out vec2 texCoords;
+#ifdef FOG
+    out vec4 fogTint;
+#endif
+
+    // Main
+    void main() {
+        // Set Final Vertex Position
+#ifdef INSTANCING
+        mat4 model = mat4(instanceModel0, instanceModel1, instanceModel2, instanceModel3);
+#endif
+        gl_Position = viewProj * model * vec4(vertexPosition, 1.0f);
+
+        // Send Texture Coordinates to Fragment Shader
+        texCoords = textureCoords;
+
+#ifdef FOG
+        // Fog Color and Amount - fogParams.x Is The Density, Clip Space W Is The View Depth
+        fogTint = vec4(fogColor.rgb, 1.0f - exp(-fogParams.x * gl_Position.w));
+#endif
+    }
+@end
+
+@fs surfaceFS
+    // Input
+    in vec2 texCoords;
+#ifdef FOG
+    in vec4 fogTint;
+#endif
+
+    // Per-Material Uniforms - Multiplied Into The Texture Color
+    layout(binding = 0) uniform surfaceMaterialUniforms {
+        vec4 tint;
+    };
+
+    // Surface Texture
+    uniform texture2D surfaceTexImg;
+    uniform sampler surfaceTexSmp;
+
+    // Output
+    out vec4 fragColor;
+
+    // Main
+    void main() {
+        // Sample Texture
+        vec4 color = texture(sampler2D(surfaceTexImg, surfaceTexSmp), texCoords) * tint;
+
+#ifdef ALPHA_TEST
+        // Discard Transparent Fragments
+        if(color.a < 0.5f) {
+            discard;
+        }
+#endif
+
+#ifdef FOG
+        // Blend Towards Fog Color
+        color.rgb = mix(color.rgb, fogTint.rgb, fogTint.a);
+#endif
+
+        // Set Final Fragment Color
+        fragColor = color;
+    }
+@end
+
+@program surfaceShader surfaceVS surfaceFS